@@ -0,0 +1,595 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : bench_io.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      Measures the throughput of the fetch and print functions for
+ *      every Fetch_Type. Generated numbers are fed to the fetch
+ *      functions through a pipe, a temporary file or an in-memory
+ *      stream, and print output goes to /dev/null or to memory.
+ *
+ * Usage:
+ *      bench_io [--perf] [size ...]
+ *
+ *      - --perf : Also report hardware counters for every case.
+ *      - size   : Values per case, 1000 and 100000 by default.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <fetch_utils.h>
+#include <file_utils.h>
+#include <perf_utils.h>
+#include <print_utils.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+
+/* [ Macros ] */
+
+#define BENCH_MIN_SECONDS (0.25)    // time every case runs for, at least
+#define BENCH_MAX_REPS (10000)      // most repetitions of a case
+#define BENCH_MAX_SIZES (16)        // most sizes on the command line
+#define BENCH_MATRIX_COLS (100)     // columns of the fetched and printed matrices
+#define BENCH_RANGE (1000000)       // values are drawn from [-BENCH_RANGE, BENCH_RANGE]
+
+/* [ Enums ] */
+
+typedef enum
+{
+    SOURCE_PIPE,        // a pipe fed by another thread, read as a FILE
+    SOURCE_STREAM,      // the same pipe read through a Fetch_Stream
+    SOURCE_FILE,        // a temporary file
+    SOURCE_MEMORY,      // fmemopen() over the generated text
+    SOURCE_COUNT,
+} Bench_Source;
+
+typedef enum
+{
+    SINK_NULL,          // /dev/null
+    SINK_MEMORY,        // open_memstream()
+    SINK_COUNT,
+} Bench_Sink;
+
+/* [ Structs ] */
+
+/* The generated input of a case, and how it is being fed. */
+typedef struct
+{
+    const char *text;       // one value per line
+    size_t len;             // bytes of text
+    const char *path;       // temporary file holding the text
+    int fds[2];             // pipe, for the pipe sources
+    pthread_t writer;       // thread filling the pipe
+    bool writing;           // whether the writer runs
+    FILE *file;             // what the fetch functions read
+    Fetch_Stream stream;    // for SOURCE_STREAM
+} Bench_Input;
+
+/* Everything a case needs to run once. */
+typedef struct
+{
+    Utils_Context *ctx;
+    Fetch_Type type;
+    int count;              // values per run
+    Bench_Source source;
+    Bench_Input *input;
+    void *arr;              // array to fetch into or print
+    void **matrix;          // matrix to print
+    FILE *sink;             // where print output goes
+} Bench_Case;
+
+typedef bool (*Bench_Fn)(Bench_Case *bc);
+
+/* [ Arrays ] */
+
+static const char *const type_names[] = { "int", "long", "long long", "float", "double" };
+static const char *const source_names[] = { "pipe", "stream", "file", "memory" };
+static const char *const sink_names[] = { "null", "memory" };
+
+/* [ Globals ] */
+
+static bool use_perf = false;
+static Perf_Counters counters;
+
+/* [ Helpers ] */
+
+/*
+ * bench_clock()
+ * ----------------------
+ * Description:
+ *      Monotonic time in seconds.
+ */
+static double bench_clock(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * bench_fill()
+ * ----------------------
+ * Description:
+ *      Fills an array with random values of the given type.
+ */
+static void bench_fill(void *arr, int count, Fetch_Type type)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        int value = rand() % (2 * BENCH_RANGE + 1) - BENCH_RANGE;
+
+        switch (type)
+        {
+            case TYPE_INT:          ((int *)arr)[i] = value;                            break;
+            case TYPE_LONG:         ((long *)arr)[i] = value;                           break;
+            case TYPE_LONG_LONG:    ((long long *)arr)[i] = value;                      break;
+            case TYPE_FLOAT:        ((float *)arr)[i] = (float)value / 64.0f;           break;
+            case TYPE_DOUBLE:       ((double *)arr)[i] = (double)value / 1024.0;        break;
+        }
+    }
+}
+
+/*
+ * bench_text()
+ * ----------------------
+ * Description:
+ *      Writes an array as text, one value per line, the way a user
+ *      would type it.
+ */
+static char *bench_text(const void *arr, int count, Fetch_Type type, size_t *len)
+{
+    char *text = NULL;
+    FILE *out = open_memstream(&text, len);
+
+    if (out == NULL)
+        return NULL;
+
+    for (int i = 0; i < count; ++i)
+    {
+        switch (type)
+        {
+            case TYPE_INT:          fprintf(out, "%d\n", ((const int *)arr)[i]);            break;
+            case TYPE_LONG:         fprintf(out, "%ld\n", ((const long *)arr)[i]);          break;
+            case TYPE_LONG_LONG:    fprintf(out, "%lld\n", ((const long long *)arr)[i]);    break;
+            case TYPE_FLOAT:        fprintf(out, "%.6f\n", ((const float *)arr)[i]);        break;
+            case TYPE_DOUBLE:       fprintf(out, "%.10f\n", ((const double *)arr)[i]);      break;
+        }
+    }
+
+    fclose(out);
+    return text;
+}
+
+/*
+ * bench_writer()
+ * ----------------------
+ * Description:
+ *      Writes the whole input into the pipe, then closes it.
+ */
+static void *bench_writer(void *arg)
+{
+    Bench_Input *input = arg;
+    size_t done = 0;
+
+    while (done < input->len)
+    {
+        ssize_t n = write(input->fds[1], input->text + done, input->len - done);
+
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+
+        done += (size_t)n;
+    }
+
+    close(input->fds[1]);
+    return NULL;
+}
+
+/*
+ * bench_open()
+ * ----------------------
+ * Description:
+ *      Makes the input readable from the start through the source,
+ *      pointing the context at it.
+ */
+static bool bench_open(Bench_Input *input, Bench_Source source, Utils_Context *ctx)
+{
+    input->file = NULL;
+    input->writing = false;
+    ctx->in = NULL;
+    ctx->stream = NULL;
+
+    switch (source)
+    {
+        case SOURCE_PIPE:
+        case SOURCE_STREAM:
+            if (pipe(input->fds) != 0)
+                return false;
+
+            input->writing = pthread_create(&input->writer, NULL, bench_writer, input) == 0;
+            if (!input->writing)
+            {
+                close(input->fds[0]);
+                close(input->fds[1]);
+                return false;
+            }
+
+            if (source == SOURCE_STREAM)
+            {
+                fetch_stream_init(&input->stream, input->fds[0]);
+                ctx->stream = &input->stream;
+                return true;
+            }
+
+            input->file = fdopen(input->fds[0], "r");
+            break;
+
+        case SOURCE_FILE:
+            input->file = fopen(input->path, "r");
+            break;
+
+        case SOURCE_MEMORY:
+            input->file = fmemopen((void *)input->text, input->len, "r");
+            break;
+
+        default:
+            break;
+    }
+
+    ctx->in = input->file;
+    return input->file != NULL;
+}
+
+/*
+ * bench_close()
+ * ----------------------
+ * Description:
+ *      Closes the source, letting a pipe writer finish first.
+ */
+static void bench_close(Bench_Input *input, Bench_Source source, Utils_Context *ctx)
+{
+    /* Closing the read end first unblocks a writer the reader gave up on. */
+    if (input->file != NULL)
+        fclose(input->file);
+    else if (source == SOURCE_STREAM)
+        close(input->fds[0]);
+
+    if (input->writing)
+        pthread_join(input->writer, NULL);
+
+    ctx->in = NULL;
+    ctx->stream = NULL;
+}
+
+/*
+ * bench_time()
+ * ----------------------
+ * Description:
+ *      Runs a case until BENCH_MIN_SECONDS have passed and returns the
+ *      seconds per run, or a negative value if a run failed.
+ */
+static double bench_time(Bench_Fn fn, Bench_Case *bc, Perf_Sample *sample)
+{
+    int reps = 0;
+    double start = bench_clock(), elapsed = 0.0;
+
+    if (use_perf)
+        perf_start(&counters);
+
+    do
+    {
+        if (!fn(bc))
+            return -1.0;
+
+        reps++;
+        elapsed = bench_clock() - start;
+    } while (elapsed < BENCH_MIN_SECONDS && reps < BENCH_MAX_REPS);
+
+    if (use_perf)
+    {
+        perf_stop(&counters, sample);
+        sample->seconds /= reps;
+
+        for (int e = 0; e < PERF_EVENTS; ++e)
+            sample->values[e] /= (uint64_t)reps;
+    }
+
+    return elapsed / reps;
+}
+
+/*
+ * bench_report()
+ * ----------------------
+ * Description:
+ *      Prints the throughput of a case.
+ */
+static void bench_report(const char *name, Fetch_Type type, int count, const char *via, size_t bytes,
+                         double seconds, const Perf_Sample *sample)
+{
+    if (seconds < 0.0)
+    {
+        printf("%-18s %-10s %9d  %-7s %12s\n", name, type_names[type], count, via, "failed");
+        return;
+    }
+
+    printf("%-18s %-10s %9d  %-7s %12.2f %12.2f\n", name, type_names[type], count, via,
+           (double)bytes / seconds / 1e6, (double)count / seconds / 1e6);
+
+    if (use_perf)
+    {
+        char label[64];
+
+        snprintf(label, sizeof(label), "  %s %s %d %s", name, type_names[type], count, via);
+        perf_report(label, sample);
+    }
+}
+
+/* [ Cases ] */
+
+static bool bench_fetch_array(Bench_Case *bc)
+{
+    if (!bench_open(bc->input, bc->source, bc->ctx))
+        return false;
+
+    Fetch_Status status = fetch_array_ctx(bc->ctx, bc->arr, bc->count, "", bc->type, -BENCH_RANGE, BENCH_RANGE, false);
+
+    bench_close(bc->input, bc->source, bc->ctx);
+    return status == FETCH_OK;
+}
+
+static bool bench_fetch_matrix(Bench_Case *bc)
+{
+    void **matrix = NULL;
+    int rows = bc->count / BENCH_MATRIX_COLS;
+
+    if (!bench_open(bc->input, bc->source, bc->ctx))
+        return false;
+
+    Fetch_Status status = fetch_matrix_ctx(bc->ctx, &matrix, rows, BENCH_MATRIX_COLS, "", bc->type,
+                                           -BENCH_RANGE, BENCH_RANGE, false);
+
+    bench_close(bc->input, bc->source, bc->ctx);
+
+    if (matrix != NULL)
+    {
+        for (int i = 0; i < rows; ++i)
+            context_release(bc->ctx, matrix[i]);
+        context_release(bc->ctx, matrix);
+    }
+
+    return status == FETCH_OK;
+}
+
+static bool bench_file_fetch_array(Bench_Case *bc)
+{
+    return file_fetch_array(bc->input->path, bc->arr, bc->count, bc->type, -BENCH_RANGE, BENCH_RANGE, NULL) == bc->count;
+}
+
+static bool bench_print_array(Bench_Case *bc)
+{
+    rewind(bc->sink);
+    bc->ctx->out = bc->sink;
+    print_array_ctx(bc->ctx, bc->arr, bc->count, "Array:", bc->type);
+    return !ferror(bc->sink);
+}
+
+static bool bench_print_matrix(Bench_Case *bc)
+{
+    rewind(bc->sink);
+    bc->ctx->out = bc->sink;
+    print_matrix_ctx(bc->ctx, bc->matrix, bc->count / BENCH_MATRIX_COLS, BENCH_MATRIX_COLS, "Matrix:", bc->type);
+    return !ferror(bc->sink);
+}
+
+/*
+ * bench_output_bytes()
+ * ----------------------
+ * Description:
+ *      Measures how many bytes a print case writes.
+ */
+static size_t bench_output_bytes(Bench_Fn fn, Bench_Case *bc)
+{
+    char *buf = NULL;
+    size_t len = 0;
+    FILE *sink = bc->sink;
+
+    bc->sink = open_memstream(&buf, &len);
+    if (bc->sink == NULL)
+    {
+        bc->sink = sink;
+        return 0;
+    }
+
+    fn(bc);
+    fflush(bc->sink);
+
+    size_t bytes = (size_t)ftell(bc->sink);
+
+    fclose(bc->sink);
+    free(buf);
+    bc->sink = sink;
+    return bytes;
+}
+
+/*
+ * bench_type()
+ * ----------------------
+ * Description:
+ *      Runs every case for one type and size.
+ */
+static int bench_type(Utils_Context *ctx, Fetch_Type type, int count, FILE *devnull)
+{
+    size_t size = type_sizes[type];
+    int rows = count / BENCH_MATRIX_COLS;
+    void *values = malloc((size_t)count * size);
+    void *arr = malloc((size_t)count * size);
+    void **matrix = malloc((size_t)(rows > 0 ? rows : 1) * sizeof(void *));
+    char path[] = "/tmp/bench_io_XXXXXX";
+    Bench_Input input = { 0 };
+    Perf_Sample sample = { 0 };
+    int fd = -1;
+
+    if (values == NULL || arr == NULL || matrix == NULL)
+        goto fail;
+
+    bench_fill(values, count, type);
+
+    for (int i = 0; i < rows; ++i)
+        matrix[i] = (char *)values + (size_t)i * BENCH_MATRIX_COLS * size;
+
+    input.text = bench_text(values, count, type, &input.len);
+    input.path = path;
+    fd = mkstemp(path);
+
+    if (input.text == NULL || fd < 0 || write(fd, input.text, input.len) != (ssize_t)input.len)
+        goto fail;
+
+    Bench_Case bc = {
+        .ctx = ctx,
+        .type = type,
+        .count = count,
+        .input = &input,
+        .arr = arr,
+        .matrix = matrix,
+    };
+
+    /* [ Fetch ] */
+    for (int s = 0; s < SOURCE_COUNT; ++s)
+    {
+        bc.source = (Bench_Source)s;
+        bench_report("fetch_array", type, count, source_names[s], input.len,
+                     bench_time(bench_fetch_array, &bc, &sample), &sample);
+    }
+
+    if (rows > 0)
+    {
+        bc.source = SOURCE_MEMORY;
+        bench_report("fetch_matrix", type, rows * BENCH_MATRIX_COLS, source_names[SOURCE_MEMORY], input.len,
+                     bench_time(bench_fetch_matrix, &bc, &sample), &sample);
+    }
+
+    bench_report("file_fetch_array", type, count, source_names[SOURCE_FILE], input.len,
+                 bench_time(bench_file_fetch_array, &bc, &sample), &sample);
+
+    /* [ Print ] */
+    char *buf = NULL;
+    size_t len = 0;
+    FILE *memory = open_memstream(&buf, &len);
+    FILE *sinks[SINK_COUNT] = { devnull, memory };
+
+    memcpy(arr, values, (size_t)count * size);
+
+    for (int s = 0; s < SINK_COUNT && memory != NULL; ++s)
+    {
+        bc.sink = sinks[s];
+        bench_report("print_array", type, count, sink_names[s], bench_output_bytes(bench_print_array, &bc),
+                     bench_time(bench_print_array, &bc, &sample), &sample);
+
+        if (rows > 0)
+            bench_report("print_matrix", type, rows * BENCH_MATRIX_COLS, sink_names[s],
+                         bench_output_bytes(bench_print_matrix, &bc),
+                         bench_time(bench_print_matrix, &bc, &sample), &sample);
+    }
+
+    /* The context outlives this call, so it must not keep the closed stream. */
+    bc.sink = devnull;
+    bc.ctx->out = devnull;
+
+    if (memory != NULL)
+        fclose(memory);
+    free(buf);
+
+    close(fd);
+    unlink(path);
+    free((void *)input.text);
+    free(matrix);
+    free(arr);
+    free(values);
+    return 0;
+
+fail:
+    fprintf(stderr, "Could not prepare the %s cases of %d values\n", type_names[type], count);
+
+    if (fd >= 0)
+    {
+        close(fd);
+        unlink(path);
+    }
+
+    free((void *)input.text);
+    free(matrix);
+    free(arr);
+    free(values);
+    return -1;
+}
+
+/* [ Main ] */
+
+int main(int argc, char *argv[])
+{
+    int sizes[BENCH_MAX_SIZES] = { 1000, 100000 };
+    int size_cnt = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--perf") == 0)
+            use_perf = true;
+        else if (size_cnt < BENCH_MAX_SIZES && atoi(argv[i]) > 0)
+            sizes[size_cnt++] = atoi(argv[i]);
+        else
+        {
+            fprintf(stderr, "Usage: %s [--perf] [size ...]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (size_cnt == 0)
+        size_cnt = 2;
+
+    /* A reader that fails must not kill the pipe writer with SIGPIPE. */
+    signal(SIGPIPE, SIG_IGN);
+    srand(42);
+
+    FILE *devnull = fopen("/dev/null", "w");
+    if (devnull == NULL)
+    {
+        perror("/dev/null");
+        return 1;
+    }
+
+    Utils_Context ctx;
+
+    context_init(&ctx, NULL, devnull, stderr);
+    ctx.color = false;
+    ctx.retry = false;
+
+    if (use_perf)
+        perf_open(&counters);
+
+    printf("%-18s %-10s %9s  %-7s %12s %12s\n", "case", "type", "values", "via", "MB/s", "Mvalues/s");
+
+    int status = 0;
+
+    for (int s = 0; s < size_cnt; ++s)
+    {
+        for (int t = TYPE_INT; t <= TYPE_DOUBLE; ++t)
+            status |= bench_type(&ctx, (Fetch_Type)t, sizes[s], devnull);
+    }
+
+    if (use_perf)
+        perf_close(&counters);
+
+    context_destroy(&ctx);
+    fclose(devnull);
+    return status == 0 ? 0 : 1;
+}
+
+/* bench_io.c */
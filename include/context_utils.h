@@ -0,0 +1,342 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : context_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      context_utils.c specifically.
+ */
+
+#ifndef CONTEXT_UTILS_H
+#define CONTEXT_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: A context carries everything the fetch_, print_ and sort_
+ * functions used to take from global state: the streams, the output
+ * buffer, colour settings and the allocator. Give every thread its own
+ * context and the library needs no locks of its own. The functions
+ * without a _ctx suffix use a per-thread default context bound to
+ * stdin, stdout and stderr.
+ */
+
+/* [ Macros ] */
+
+#define CONTEXT_DEFAULT_BUFFER (BUFFER * 8)     // size of the default contexts' fixed buffer
+#define CONTEXT_ARENA_BLOCK (1 << 20)           // default size of the blocks of an arena
+
+/* [ Structs ] */
+
+struct Fetch_Stream;    // defined in fetch_utils.h
+
+typedef struct
+{
+    void *(*alloc)(void *user, size_t size);                // malloc() equivalent
+    void *(*realloc)(void *user, void *ptr, size_t size);   // realloc() equivalent
+    void (*free)(void *user, void *ptr);                    // free() equivalent
+    void *user;                                             // passed to every call
+} Utils_Allocator;
+
+/*
+ * Utils_Arena
+ * ----------------------
+ * Description:
+ *      A bump allocator carving allocations out of large blocks, all of
+ *      which are released at once. Plugged into a context through
+ *      context_arena_allocator(), it gives request-scoped data such as
+ *      hash tables and scratch buffers a single point of release.
+ */
+typedef struct
+{
+    struct Utils_Arena_Block *head;     // block being carved, linked to the older ones
+    size_t block_size;                  // smallest size of a new block
+    size_t used;                        // bytes handed out since the last reset
+} Utils_Arena;
+
+typedef struct
+{
+    int max_elements;           // elements shown per array before eliding the middle, 0 for all
+    int max_rows;               // rows shown per matrix before eliding the middle, 0 for all
+    bool align;                 // pad matrix columns to their widest shown value
+    int float_precision;        // digits after the point for TYPE_FLOAT
+    int double_precision;       // digits after the point for TYPE_DOUBLE
+} Print_Config;
+
+typedef struct
+{
+    FILE *in;                   // where fetch_ functions read from
+    FILE *out;                  // where prompts and print_ output go
+    FILE *err;                  // where print_log_ctx() messages go
+    struct Fetch_Stream *stream; // read instead of in when set, see fetch_utils.h
+    int timeout;                // milliseconds a fetch_ call may take, -1 for no limit
+    bool retry;                 // whether fetch_ functions re-prompt on invalid input
+    bool color;                 // whether ANSI colour codes are emitted
+    Print_Config print;         // how print_ functions lay out arrays
+    bool interactive;           // whether prompts are flushed before reading
+    Utils_Allocator allocator;  // used by every function that allocates
+
+    /* Record buffer, managed by context_begin() and context_end(). */
+    char *buf;
+    size_t len;
+    size_t cap;
+    bool growable;              // false for a fixed, caller-owned buffer
+    FILE *target;               // stream of the record being built
+} Utils_Context;
+
+/* [ Functions ] */
+
+/*
+ * Function: context_init()
+ * ----------------------
+ * Description:
+ *      Initializes a context with the given streams, colours enabled,
+ *      the malloc() family as allocator and a growable record buffer.
+ *      Input is read from in with no timeout, re-prompting on invalid
+ *      input like the functions without the _ctx suffix, and arrays are
+ *      printed whole with 2 (float) and 4 (double) decimals.
+ *
+ * Arguments:
+ *      - ctx   : The context to initialize.
+ *      - in    : Input stream (may be NULL if nothing is fetched).
+ *      - out   : Output stream.
+ *      - err   : Stream for log messages.
+ *
+ * Returns: -
+ */
+void context_init(Utils_Context *ctx, FILE *in, FILE *out, FILE *err);
+
+/*
+ * Function: context_destroy()
+ * ----------------------
+ * Description:
+ *      Releases the record buffer of a context. The streams are
+ *      left open.
+ *
+ * Arguments:
+ *      - ctx   : The context to release.
+ *
+ * Returns: -
+ */
+void context_destroy(Utils_Context *ctx);
+
+/*
+ * Function: context_default()
+ * ----------------------
+ * Description:
+ *      Returns the calling thread's default context, bound to stdin,
+ *      stdout and stderr with a fixed buffer of CONTEXT_DEFAULT_BUFFER
+ *      bytes. Records longer than that are written in several pieces.
+ *
+ * Arguments: -
+ *
+ * Returns:
+ *      A context owned by the calling thread.
+ */
+Utils_Context *context_default(void);
+
+/*
+ * Function: context_begin()
+ * ----------------------
+ * Description:
+ *      Starts a new record that will be written to the stream.
+ *
+ * Arguments:
+ *      - ctx       : The context to buffer in.
+ *      - stream    : Where the record goes once complete.
+ *
+ * Returns: -
+ */
+void context_begin(Utils_Context *ctx, FILE *stream);
+
+/*
+ * Function: context_append()
+ * ----------------------
+ * Description:
+ *      Appends formatted text to the current record.
+ *
+ * Arguments:
+ *      - ctx       : The context to buffer in.
+ *      - format    : printf() format string.
+ *      - ...       : Arguments matching the format.
+ *
+ * Returns: -
+ */
+void context_append(Utils_Context *ctx, const char *format, ...);
+
+/*
+ * Function: context_vappend()
+ * ----------------------
+ * Description:
+ *      va_list version of context_append().
+ */
+void context_vappend(Utils_Context *ctx, const char *format, va_list args);
+
+/*
+ * Function: context_write()
+ * ----------------------
+ * Description:
+ *      Appends raw bytes to the current record, without formatting.
+ *
+ * Arguments:
+ *      - ctx   : The context to buffer in.
+ *      - data  : Bytes to append.
+ *      - len   : Number of bytes.
+ *
+ * Returns: -
+ */
+void context_write(Utils_Context *ctx, const char *data, size_t len);
+
+/*
+ * Function: context_end()
+ * ----------------------
+ * Description:
+ *      Writes the current record with a single fwrite(), so it cannot
+ *      be interleaved with the output of other threads.
+ *
+ * Arguments:
+ *      - ctx   : The context holding the record.
+ *
+ * Returns: -
+ */
+void context_end(Utils_Context *ctx);
+
+/*
+ * Function: context_arena_init()
+ * ----------------------
+ * Description:
+ *      Initializes an empty arena. No memory is allocated until the
+ *      first allocation.
+ *
+ * Arguments:
+ *      - arena         : The arena to initialize.
+ *      - block_size    : Smallest block to allocate, 0 for CONTEXT_ARENA_BLOCK.
+ *
+ * Returns: -
+ */
+void context_arena_init(Utils_Arena *arena, size_t block_size);
+
+/*
+ * Function: context_arena_alloc()
+ * ----------------------
+ * Description:
+ *      Allocates memory from the arena, aligned for any type. Requests
+ *      larger than the block size get a block of their own.
+ *
+ * Arguments:
+ *      - arena : The arena to allocate from.
+ *      - size  : Number of bytes.
+ *
+ * Returns:
+ *      The memory, or NULL if a new block could not be allocated.
+ *
+ * Warning:
+ *      Not thread-safe: give every thread its own arena.
+ */
+void *context_arena_alloc(Utils_Arena *arena, size_t size);
+
+/*
+ * Function: context_arena_reset()
+ * ----------------------
+ * Description:
+ *      Releases every allocation at once, keeping the newest block
+ *      for the next ones.
+ *
+ * Arguments:
+ *      - arena : The arena to reset.
+ *
+ * Returns: -
+ */
+void context_arena_reset(Utils_Arena *arena);
+
+/*
+ * Function: context_arena_destroy()
+ * ----------------------
+ * Description:
+ *      Frees every block of the arena.
+ *
+ * Arguments:
+ *      - arena : The arena to destroy.
+ *
+ * Returns: -
+ */
+void context_arena_destroy(Utils_Arena *arena);
+
+/*
+ * Function: context_arena_allocator()
+ * ----------------------
+ * Description:
+ *      Returns an allocator drawing from the arena, for a context or a
+ *      data structure. Freeing through it does nothing, and the latest
+ *      allocation grows in place when there is room after it.
+ *
+ * Arguments:
+ *      - arena : The arena, which must outlive every user of the allocator.
+ *
+ * Returns:
+ *      The allocator.
+ *
+ * Example:
+ *      Utils_Arena arena;
+ *      context_arena_init(&arena, 0);
+ *      ctx.allocator = context_arena_allocator(&arena);
+ *      ...
+ *      context_arena_destroy(&arena);
+ */
+Utils_Allocator context_arena_allocator(Utils_Arena *arena);
+
+/* [ Inline Functions ] */
+
+/*
+ * context_alloc()
+ * ----------------------
+ * Description:
+ *      Allocates memory through the context's allocator.
+ */
+static inline void *context_alloc(Utils_Context *ctx, size_t size)
+{
+    return ctx->allocator.alloc(ctx->allocator.user, size);
+}
+
+/*
+ * context_realloc()
+ * ----------------------
+ * Description:
+ *      Resizes memory through the context's allocator.
+ */
+static inline void *context_realloc(Utils_Context *ctx, void *ptr, size_t size)
+{
+    return ctx->allocator.realloc(ctx->allocator.user, ptr, size);
+}
+
+/*
+ * context_release()
+ * ----------------------
+ * Description:
+ *      Frees memory through the context's allocator.
+ */
+static inline void context_release(Utils_Context *ctx, void *ptr)
+{
+    ctx->allocator.free(ctx->allocator.user, ptr);
+}
+
+#endif // CONTEXT_UTILS_H
+
+/* context_utils.h */
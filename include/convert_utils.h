@@ -0,0 +1,75 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : convert_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      convert_utils.c specifically.
+ */
+
+#ifndef CONVERT_UTILS_H
+#define CONVERT_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/* [ Enums ] */
+
+typedef enum
+{
+    CONVERT_CAST,       // plain C conversion, out-of-range values are not handled
+    CONVERT_SATURATE,   // clamp to the destination range, NaN becomes zero
+    CONVERT_CHECKED,    // stop at the first value the destination cannot hold
+} Convert_Mode;
+
+/* [ Functions ] */
+
+/*
+ * Function: convert_array()
+ * ----------------------
+ * Description:
+ *      Converts a whole array from one Fetch_Type to another. Every type
+ *      pair has its own loop, so integers never pass through double, and
+ *      the common pairs (int to float/double, float to double, double to
+ *      float, int widening and narrowing) use AVX2 when the CPU has it.
+ *
+ * Arguments:
+ *      - dst       : Destination array of len elements.
+ *      - dst_type  : The data type of the destination.
+ *      - src       : Source array of len elements.
+ *      - src_type  : The data type of the source.
+ *      - len       : Number of elements to convert.
+ *      - mode      : How values outside the destination range are handled.
+ *
+ * Returns:
+ *      The number of values converted, which is len on success. With
+ *      CONVERT_CHECKED it is the index of the first value that does not fit.
+ *      -1 on invalid arguments.
+ *
+ * Notes:
+ *      - dst and src must not overlap, unless both types have the same
+ *      representation (e.g. long and long long on 64-bit Unix).
+ *      - Double to float only fails the range check for finite values past
+ *      FLT_MAX; precision loss is never an error.
+ */
+int convert_array(void *dst, Fetch_Type dst_type, const void *src, Fetch_Type src_type, int len, Convert_Mode mode);
+
+#endif // CONVERT_UTILS_H
+
+/* convert_utils.h */
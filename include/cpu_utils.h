@@ -0,0 +1,132 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : cpu_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      cpu_utils.c specifically.
+ */
+
+#ifndef CPU_UTILS_H
+#define CPU_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: The CPU is probed once, when the library is loaded, and the
+ * result is kept as a CPU_Tier, read with cpu_tier(), which is a plain
+ * load, so no call repeats the feature checks. Modules with kernels for
+ * several tiers (stats, pack) index a table of them by tier; those with
+ * a single AVX2 kernel (convert, set intersection, scan, matrix) test
+ * cpu_tier() >= CPU_TIER_AVX2 at the call site.
+ *
+ * Setting the LIBUTILS_CPU_TIER environment variable to scalar, sse2,
+ * avx2 or avx512 caps the tier used, e.g. to compare code paths or to
+ * reproduce what an older machine runs. A tier above what the CPU
+ * supports is lowered to the detected one.
+ */
+
+/* [ Macros ] */
+
+#define CPU_TIERS (4)                       // number of CPU_Tier values
+#define CPU_TIER_ENV "LIBUTILS_CPU_TIER"    // environment variable capping the tier
+
+/* [ Enums ] */
+
+typedef enum
+{
+    CPU_TIER_SCALAR,    // portable C only
+    CPU_TIER_SSE2,      // 128-bit SSE2 kernels
+    CPU_TIER_AVX2,      // 256-bit AVX2 kernels (with POPCNT)
+    CPU_TIER_AVX512,    // AVX-512F; runs the AVX2 kernels where there is no AVX-512 one
+} CPU_Tier;
+
+/* [ Variables ] */
+
+/* The tier in use; read it through cpu_tier(). */
+extern CPU_Tier cpu_active_tier;
+
+/* [ Inline Functions ] */
+
+/*
+ * cpu_tier()
+ * ----------------------
+ * Description:
+ *      Returns the tier whose kernels should run. Scalar until the
+ *      library's load-time probe has run.
+ */
+static inline CPU_Tier cpu_tier(void)
+{
+    return cpu_active_tier;
+}
+
+/* [ Functions ] */
+
+/*
+ * Function: cpu_detected_tier()
+ * ----------------------
+ * Description:
+ *      Returns the highest tier the CPU supports, regardless of
+ *      LIBUTILS_CPU_TIER or cpu_set_tier().
+ *
+ * Arguments: -
+ *
+ * Returns:
+ *      The detected tier, CPU_TIER_SCALAR on non-x86 builds.
+ */
+CPU_Tier cpu_detected_tier(void);
+
+/*
+ * Function: cpu_set_tier()
+ * ----------------------
+ * Description:
+ *      Forces the tier used from now on, for testing every code path
+ *      on one machine. cpu_set_tier(cpu_detected_tier()) undoes it.
+ *
+ * Arguments:
+ *      - tier  : The tier to use.
+ *
+ * Returns:
+ *      0 on success, -1 if the tier is invalid or above the detected one,
+ *      in which case the tier in use is unchanged.
+ *
+ * Warning:
+ *      Not synchronized: do not change the tier while other threads are
+ *      running library functions.
+ */
+int cpu_set_tier(CPU_Tier tier);
+
+/*
+ * Function: cpu_tier_name()
+ * ----------------------
+ * Description:
+ *      Returns the name of a tier, as accepted by LIBUTILS_CPU_TIER.
+ *
+ * Arguments:
+ *      - tier  : The tier.
+ *
+ * Returns:
+ *      "scalar", "sse2", "avx2", "avx512", or "?" for an invalid tier.
+ */
+const char *cpu_tier_name(CPU_Tier tier);
+
+#endif // CPU_UTILS_H
+
+/* cpu_utils.h */
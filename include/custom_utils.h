@@ -40,6 +40,15 @@
 #define BOLD "\x1b[1m"  // bold text
 #define BUFFER (512)    // buffer limit
 
+/*
+ * [INFO]: Vectorized kernels are compiled with per-function target
+ * attributes and picked at runtime, so the library itself never needs
+ * to be built with -mavx2 or similar flags.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UTILS_X86_SIMD  // x86 SIMD kernels are available
+#endif
+
 /* [ Structs ] */
 
 typedef struct 
@@ -82,7 +91,7 @@ extern const Color CYAN;
  *      - Octals and hexadecimals in code get interpreted as integers - long long.
  *      - Defaults to zero for easier debugging.
  */
-extern size_t type_sizes[];
+extern const size_t type_sizes[];
 
 /* [ Inline Functions ] */
 
@@ -36,6 +36,42 @@
  * will only have a shortened description for code clarity.
  */
 
+/* [ Macros ] */
+
+#define FETCH_STREAM_BUFFER (BUFFER * 4)    // bytes a Fetch_Stream buffers ahead
+#define FETCH_STREAM_MAX (64)               // most streams fetch_stream_wait() watches at once
+
+/* [ Enums ] */
+
+typedef enum
+{
+    FETCH_OK,       // a value was read
+    FETCH_TIMEOUT,  // the deadline passed before a whole line arrived
+    FETCH_EOF,      // the input ended
+    FETCH_INVALID,  // the line was not a number in range (only when not retrying)
+    FETCH_ERROR,    // the input could not be read, or invalid arguments
+} Fetch_Status;
+
+/* [ Structs ] */
+
+/*
+ * Fetch_Stream
+ * ----------------------
+ * Description:
+ *      A file descriptor with its own read-ahead buffer, read with poll()
+ *      so that no call waits past its deadline. Set ctx->stream to one to
+ *      make the fetch_*_ctx() functions read from it, or call the
+ *      fetch_stream_*() functions directly.
+ */
+typedef struct Fetch_Stream
+{
+    int fd;                             // descriptor to read, negative to ignore
+    char buf[FETCH_STREAM_BUFFER];      // bytes read but not yet consumed
+    size_t head;                        // first unconsumed byte
+    size_t tail;                        // one past the last byte read
+    bool eof;                           // read() returned 0
+} Fetch_Stream;
+
 /* [ Functions ] */
 
 /*
@@ -115,6 +151,188 @@ void fetch_string(char *input, const char *prompt);
  */
 int fetch_matrix(void ***matrix, int rows, int cols, const char *prompt, Fetch_Type type, double min, double max, bool disp_cnt);
 
+/*
+ * Function: fetch_array_ctx() / fetch_number_ctx() / fetch_string_ctx() / fetch_matrix_ctx()
+ * ----------------------
+ * Description:
+ *      The same functions on an explicit context: input is read from
+ *      ctx->stream if set or ctx->in otherwise, prompts go to ctx->out and
+ *      errors to ctx->err, and fetch_matrix_ctx() allocates through
+ *      ctx->allocator. Prompts are only flushed when ctx->interactive is
+ *      set, and fetch_matrix_ctx() uses it instead of isatty() to decide
+ *      whether to print row prompts.
+ *
+ *      Instead of looping forever, they return as soon as the input ends,
+ *      fails, or (with a stream) ctx->timeout milliseconds have passed since
+ *      the call began. Invalid input is re-prompted while ctx->retry is set,
+ *      and returned as FETCH_INVALID otherwise.
+ *
+ * Arguments:
+ *      - ctx       : The context to read and print through.
+ *      - (others)  : As for the functions without the _ctx suffix.
+ *
+ * Returns:
+ *      FETCH_OK once everything is read, or the status of the value that
+ *      could not be. Arrays keep the elements read before it; a matrix is
+ *      freed and set to NULL. Allocation failures return FETCH_ERROR.
+ *
+ * Notes:
+ *      - The functions without the suffix use context_default(), so
+ *      threads that each own a context can fetch concurrently. They return
+ *      at the end of input instead of spinning; fetch_matrix() then
+ *      returns -1.
+ *      - ctx->timeout only applies to ctx->stream, since a FILE may have
+ *      buffered input that poll() cannot see.
+ *      - A matrix from fetch_matrix_ctx() must be freed with the same
+ *      context's allocator.
+ */
+Fetch_Status fetch_array_ctx(Utils_Context *ctx, void *arr, int len, const char *prompt, Fetch_Type type, double min, double max, bool disp_cnt);
+Fetch_Status fetch_number_ctx(Utils_Context *ctx, void *input, const char *prompt, double min, double max, Fetch_Type type);
+Fetch_Status fetch_string_ctx(Utils_Context *ctx, char *input, const char *prompt);
+Fetch_Status fetch_matrix_ctx(Utils_Context *ctx, void ***matrix, int rows, int cols, const char *prompt, Fetch_Type type, double min, double max, bool disp_cnt);
+
+/*
+ * Function: fetch_stream_init()
+ * ----------------------
+ * Description:
+ *      Binds a stream to a file descriptor. The descriptor's flags are
+ *      left alone; it is only read once poll() reports data.
+ *
+ * Arguments:
+ *      - stream    : The stream to initialize.
+ *      - fd        : Descriptor to read, such as STDIN_FILENO or a pipe.
+ *
+ * Returns: -
+ *
+ * Notes:
+ *      - Do not mix with stdio reads of the same descriptor: whatever
+ *      the FILE has buffered is invisible to the stream.
+ */
+void fetch_stream_init(Fetch_Stream *stream, int fd);
+
+/*
+ * Function: fetch_stream_line()
+ * ----------------------
+ * Description:
+ *      Reads one line, newline included, like fgets() but without waiting
+ *      more than timeout milliseconds. Lines longer than size - 1 bytes
+ *      are returned in pieces.
+ *
+ * Arguments:
+ *      - stream    : The stream to read from.
+ *      - line      : Where to store the line.
+ *      - size      : Size of line in bytes.
+ *      - timeout   : Milliseconds to wait at most, -1 for no limit.
+ *
+ * Returns:
+ *      FETCH_OK, FETCH_TIMEOUT, FETCH_EOF or FETCH_ERROR. A partial line
+ *      stays buffered after a timeout and is completed by the next call.
+ */
+Fetch_Status fetch_stream_line(Fetch_Stream *stream, char *line, size_t size, int timeout);
+
+/*
+ * Function: fetch_stream_number()
+ * ----------------------
+ * Description:
+ *      Reads one line and parses it as a number in [min, max], with the
+ *      same rules as fetch_number() but without prompting or logging.
+ *
+ * Arguments:
+ *      - stream    : The stream to read from.
+ *      - value     : Where to store the number, only written on success.
+ *      - min       : Minimal argument accepted.
+ *      - max       : Maximal argument accepted.
+ *      - timeout   : Milliseconds to wait at most, -1 for no limit.
+ *
+ * Returns:
+ *      FETCH_OK, FETCH_TIMEOUT, FETCH_EOF, FETCH_INVALID (the line is
+ *      consumed) or FETCH_ERROR.
+ */
+Fetch_Status fetch_stream_number(Fetch_Stream *stream, double *value, double min, double max, int timeout);
+
+/*
+ * Function: fetch_stream_wait()
+ * ----------------------
+ * Description:
+ *      Waits until one of several streams has a line of up to BUFFER
+ *      bytes buffered, or has ended, so that a single thread can serve
+ *      many inputs. All the streams are polled together, and whatever is
+ *      readable is read ahead into its buffer.
+ *
+ * Arguments:
+ *      - streams   : The streams to watch. NULL entries and streams with
+ *                    a negative fd are skipped.
+ *      - count     : Number of streams, at most FETCH_STREAM_MAX.
+ *      - timeout   : Milliseconds to wait at most, -1 for no limit.
+ *      - ready     : Set to the index of the stream that is ready.
+ *
+ * Returns:
+ *      FETCH_OK with *ready set, FETCH_TIMEOUT, or FETCH_ERROR (with
+ *      *ready set if a read failed).
+ *
+ * Notes:
+ *      - An ended stream stays ready; fetch_stream_line() then returns
+ *      FETCH_EOF, and the caller should set its fd to -1 to drop it.
+ *      - Earlier streams win when several are ready, so drain the one
+ *      returned before waiting again.
+ */
+Fetch_Status fetch_stream_wait(Fetch_Stream *const *streams, int count, int timeout, int *ready);
+
+/*
+ * Function: fetch_number_<type>() / fetch_array_<type>()
+ * ----------------------
+ * Description:
+ *      Type-specialized versions of fetch_number() and fetch_array().
+ *      Their loops only store one type, so there is no switch per element.
+ *      fetch_array() forwards to these after switching once on the type.
+ *
+ * Arguments:
+ *      - input / arr   : Where to store the value(s).
+ *      - len           : Number of elements in the array.
+ *      - prompt        : Prompt message to display.
+ *      - min           : Minimal argument accepted.
+ *      - max           : Maximal argument accepted.
+ *      - disp_cnt      : The option to display counter.
+ *
+ * Returns: -
+ */
+void fetch_number_int(int *input, const char *prompt, double min, double max);
+void fetch_number_long(long *input, const char *prompt, double min, double max);
+void fetch_number_long_long(long long *input, const char *prompt, double min, double max);
+void fetch_number_float(float *input, const char *prompt, double min, double max);
+void fetch_number_double(double *input, const char *prompt, double min, double max);
+
+void fetch_array_int(int *arr, int len, const char *prompt, double min, double max, bool disp_cnt);
+void fetch_array_long(long *arr, int len, const char *prompt, double min, double max, bool disp_cnt);
+void fetch_array_long_long(long long *arr, int len, const char *prompt, double min, double max, bool disp_cnt);
+void fetch_array_float(float *arr, int len, const char *prompt, double min, double max, bool disp_cnt);
+void fetch_array_double(double *arr, int len, const char *prompt, double min, double max, bool disp_cnt);
+
+/*
+ * FETCH_NUMBER() / FETCH_ARRAY()
+ * ----------------------
+ * Description:
+ *      Pick the typed fetch function from the destination's type
+ *      at compile time.
+ *
+ * Example:
+ *      long values[4];
+ *      FETCH_ARRAY(values, 4, "Value", 0, 100, true);
+ */
+#define FETCH_NUMBER(input, prompt, min, max) _Generic((input), \
+        int *: fetch_number_int,                                \
+        long *: fetch_number_long,                              \
+        long long *: fetch_number_long_long,                    \
+        float *: fetch_number_float,                            \
+        double *: fetch_number_double)(input, prompt, min, max)
+
+#define FETCH_ARRAY(arr, len, prompt, min, max, disp_cnt) _Generic((arr), \
+        int *: fetch_array_int,                                 \
+        long *: fetch_array_long,                               \
+        long long *: fetch_array_long_long,                     \
+        float *: fetch_array_float,                             \
+        double *: fetch_array_double)(arr, len, prompt, min, max, disp_cnt)
+
 /* [ Inline Functions ] */
 
 /*
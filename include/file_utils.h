@@ -0,0 +1,171 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : file_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      file_utils.c specifically.
+ */
+
+#ifndef FILE_UTILS_H
+#define FILE_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: These are the file counterparts of fetch_array() and
+ * fetch_matrix(). Instead of one fgets() per value, files are read in
+ * large chunks with several reads in flight, and each chunk is parsed on
+ * the calling thread while the next ones are being read. On Linux the
+ * reads go through io_uring into registered buffers; elsewhere, or when
+ * io_uring is unavailable, a small pool of threads issues pread() calls.
+ */
+
+/* [ Macros ] */
+
+#define FILE_CHUNK_SIZE (1 << 20)   // default bytes per read
+#define FILE_QUEUE_DEPTH (8)        // default number of reads in flight
+#define FILE_TOKEN_MAX (64)         // longest number accepted, in characters
+
+/* [ Enums ] */
+
+typedef enum
+{
+    FILE_BACKEND_AUTO,      // io_uring if the kernel allows it, pread() otherwise
+    FILE_BACKEND_URING,     // io_uring only, failing if it is unavailable
+    FILE_BACKEND_PREAD,     // pread() from a pool of threads
+} File_Backend;
+
+/* [ Structs ] */
+
+typedef struct
+{
+    size_t chunk_size;      // bytes per read, 0 for FILE_CHUNK_SIZE
+    int depth;              // reads in flight, 0 for FILE_QUEUE_DEPTH
+    int threads;            // pread() threads, 0 for one per read in flight
+    File_Backend backend;   // how the reads are issued
+} File_Options;
+
+/*
+ * File_Chunk_Fn
+ * ----------------------
+ * Description:
+ *      Receives the chunks of every file, in order within each file.
+ *      Chunks of different files may be interleaved.
+ *
+ * Arguments:
+ *      - user  : The pointer given to file_read_chunks().
+ *      - file  : Index of the file in the paths array.
+ *      - data  : The chunk, only valid until the callback returns.
+ *      - len   : Length of the chunk, 0 for an empty file.
+ *      - last  : Whether this is the final chunk of the file.
+ *
+ * Returns:
+ *      0 to continue, anything else to stop reading.
+ */
+typedef int (*File_Chunk_Fn)(void *user, int file, const char *data, size_t len, bool last);
+
+/* [ Functions ] */
+
+/*
+ * Function: file_read_chunks()
+ * ----------------------
+ * Description:
+ *      Reads several files with up to opts->depth reads in flight and
+ *      hands every completed chunk to fn on the calling thread, so that
+ *      parsing one chunk overlaps with reading the next ones.
+ *
+ * Arguments:
+ *      - paths : The files to read.
+ *      - count : Number of files.
+ *      - opts  : Read options, NULL for the defaults.
+ *      - fn    : Called with every chunk.
+ *      - user  : Passed to fn.
+ *
+ * Returns:
+ *      0 on success, -1 if a file cannot be opened or read, on
+ *      allocation failure, or if fn asked to stop.
+ *
+ * Notes:
+ *      - Files are opened one after another as reading reaches them,
+ *      and closed once their last chunk is delivered.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int file_read_chunks(const char *const *paths, int count, const File_Options *opts, File_Chunk_Fn fn, void *user);
+
+/*
+ * Function: file_fetch_arrays()
+ * ----------------------
+ * Description:
+ *      Loads one array per file, each file holding numbers separated by
+ *      whitespace or commas. Every value is checked against [min, max]
+ *      like fetch_array() does, and numbers split across two chunks are
+ *      carried over and parsed whole.
+ *
+ * Arguments:
+ *      - paths     : The files to read.
+ *      - count     : Number of files (and of arrays).
+ *      - arrays    : Destination of every file, like the rows of a matrix.
+ *      - lens      : Capacity of every array, in elements.
+ *      - counts    : Set to the number of values read from every file.
+ *      - type      : The data type of the arrays.
+ *      - min       : Minimal value accepted.
+ *      - max       : Maximal value accepted.
+ *      - opts      : Read options, NULL for the defaults.
+ *
+ * Returns:
+ *      0 on success, -1 on a read error, an invalid or out-of-range
+ *      value, a file with more values than its array holds, or invalid
+ *      arguments. The offending file and value are logged.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int file_fetch_arrays(const char *const *paths, int count, void **arrays, const int *lens, int *counts,
+                      Fetch_Type type, double min, double max, const File_Options *opts);
+
+/*
+ * Function: file_fetch_array()
+ * ----------------------
+ * Description:
+ *      file_fetch_arrays() for a single file.
+ *
+ * Arguments:
+ *      - path      : The file to read.
+ *      - arr       : Destination array.
+ *      - len       : Capacity of the array, in elements.
+ *      - type      : The data type of the array.
+ *      - min       : Minimal value accepted.
+ *      - max       : Maximal value accepted.
+ *      - opts      : Read options, NULL for the defaults.
+ *
+ * Returns:
+ *      The number of values read, or -1 on failure.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int file_fetch_array(const char *path, void *arr, int len, Fetch_Type type, double min, double max, const File_Options *opts);
+
+#endif // FILE_UTILS_H
+
+/* file_utils.h */
@@ -0,0 +1,273 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : hash_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      hash_utils.c specifically.
+ */
+
+#ifndef HASH_UTILS_H
+#define HASH_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <context_utils.h>
+#include <stdint.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: These functions count, list and sum values by key in expected
+ * linear time, where sorting first would cost O(n log n). Float and
+ * double keys are compared by value, except that 0.0 and -0.0 are the
+ * same key and so are all NaNs.
+ */
+
+/* [ Macros ] */
+
+#define HASH_MIN_CAPACITY (16)  // fewest slots of a table
+#define HASH_BATCH (16)         // keys hashed and prefetched ahead of their insertion
+
+/* [ Structs ] */
+
+/*
+ * Hash_Table
+ * ----------------------
+ * Description:
+ *      An open-addressing table with linear probing, stored as separate
+ *      arrays (SoA). Probing walks the one-byte tags, 64 to a cache line,
+ *      and only reads a key when its tag matches 7 bits of the hash. The
+ *      capacity is a power of two and the table grows past 3/4 full.
+ *
+ *      Occupied slots have a non-zero tag; their key, count and sum are
+ *      at the same index of the other arrays.
+ */
+typedef struct
+{
+    uint8_t *tags;              // 0 for an empty slot, else 0x80 | 7 bits of the hash
+    void *keys;                 // capacity keys of type
+    long long *counts;          // occurrences of every key
+    double *sums;               // group-by sum of every key, NULL until hash_add_sums()
+    size_t capacity;            // number of slots, a power of two
+    int count;                  // number of distinct keys
+    Fetch_Type type;            // type of the keys
+    Utils_Allocator allocator;  // where the arrays come from
+} Hash_Table;
+
+/* [ Inline Functions ] */
+
+/*
+ * hash_mix64()
+ * ----------------------
+ * Description:
+ *      Scrambles 64 bits so that every input bit affects every output
+ *      bit (the MurmurHash3 finalizer). Keys that differ only in their
+ *      high bits, or that are multiples of a power of two, still spread
+ *      evenly over the low bits used to pick a slot.
+ */
+static inline uint64_t hash_mix64(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/* [ Functions ] */
+
+/*
+ * Function: hash_init()
+ * ----------------------
+ * Description:
+ *      Creates an empty table sized for the expected number of
+ *      distinct keys.
+ *
+ * Arguments:
+ *      - table     : The table to create.
+ *      - type      : The data type of the keys.
+ *      - expected  : Distinct keys expected, 0 if unknown.
+ *      - allocator : Where the table's memory comes from, e.g. from
+ *                    context_arena_allocator(), or NULL for the default
+ *                    context's allocator.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation, release it with hash_free().
+ */
+int hash_init(Hash_Table *table, Fetch_Type type, int expected, const Utils_Allocator *allocator);
+
+/*
+ * Function: hash_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a table.
+ *
+ * Arguments:
+ *      - table : The table to release.
+ *
+ * Returns: -
+ */
+void hash_free(Hash_Table *table);
+
+/*
+ * Function: hash_add()
+ * ----------------------
+ * Description:
+ *      Counts every key of an array. Keys are hashed HASH_BATCH at a time
+ *      and their slots prefetched before any is probed, so the cache
+ *      misses of a large table overlap instead of adding up.
+ *
+ * Arguments:
+ *      - table : The table to add to.
+ *      - keys  : Array of keys of the table's type.
+ *      - len   : Number of keys.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or if the table could not
+ *      grow, in which case the keys added so far are kept.
+ */
+int hash_add(Hash_Table *table, const void *keys, int len);
+
+/*
+ * Function: hash_add_sums()
+ * ----------------------
+ * Description:
+ *      hash_add() also summing, for every key, the values at the same
+ *      index of a parallel array.
+ *
+ * Arguments:
+ *      - table         : The table to add to.
+ *      - keys          : Array of keys of the table's type.
+ *      - values        : Array of len values.
+ *      - len           : Number of keys and values.
+ *      - value_type    : The data type of the values.
+ *
+ * Returns:
+ *      As for hash_add().
+ */
+int hash_add_sums(Hash_Table *table, const void *keys, const void *values, int len, Fetch_Type value_type);
+
+/*
+ * Function: hash_find()
+ * ----------------------
+ * Description:
+ *      Looks a key up.
+ *
+ * Arguments:
+ *      - table : The table to search.
+ *      - key   : Pointer to the key, of the table's type.
+ *
+ * Returns:
+ *      The slot of the key, whose count is table->counts[slot], or -1
+ *      if the key is not in the table.
+ */
+long long hash_find(const Hash_Table *table, const void *key);
+
+/*
+ * Function: hash_items()
+ * ----------------------
+ * Description:
+ *      Copies the distinct keys out, in no particular order, with their
+ *      counts and sums at the same index.
+ *
+ * Arguments:
+ *      - table     : The table to read.
+ *      - keys      : Buffer of table->count keys, or NULL.
+ *      - counts    : Buffer of table->count counts, or NULL.
+ *      - sums      : Buffer of table->count sums, or NULL.
+ *
+ * Returns:
+ *      The number of distinct keys, or -1 on invalid arguments.
+ */
+int hash_items(const Hash_Table *table, void *keys, long long *counts, double *sums);
+
+/*
+ * Function: hash_count_distinct()
+ * ----------------------
+ * Description:
+ *      Counts the distinct values of an array.
+ *
+ * Arguments:
+ *      - arr   : The array.
+ *      - len   : Number of elements.
+ *      - type  : The data type of the array.
+ *
+ * Returns:
+ *      The number of distinct values, or -1 on invalid arguments or
+ *      allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int hash_count_distinct(const void *arr, int len, Fetch_Type type);
+
+/*
+ * Function: hash_frequencies()
+ * ----------------------
+ * Description:
+ *      Lists the distinct values of an array with how often each occurs,
+ *      like unique() on a sorted copy but in no particular order.
+ *
+ * Arguments:
+ *      - arr       : The array.
+ *      - len       : Number of elements.
+ *      - type      : The data type of the array.
+ *      - keys      : Buffer of len elements for the distinct values.
+ *      - counts    : Buffer of len counts, at the same index.
+ *
+ * Returns:
+ *      The number of distinct values, or -1 on invalid arguments or
+ *      allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int hash_frequencies(const void *arr, int len, Fetch_Type type, void *keys, int *counts);
+
+/*
+ * Function: hash_group_sum()
+ * ----------------------
+ * Description:
+ *      Sums values grouped by key: SELECT key, SUM(value) ... GROUP BY key.
+ *
+ * Arguments:
+ *      - keys          : Array of keys.
+ *      - values        : Array of values at the same index.
+ *      - len           : Number of keys and values.
+ *      - key_type      : The data type of the keys.
+ *      - value_type    : The data type of the values.
+ *      - out_keys      : Buffer of len elements for the distinct keys.
+ *      - out_sums      : Buffer of len sums, at the same index.
+ *
+ * Returns:
+ *      The number of distinct keys, or -1 on invalid arguments or
+ *      allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int hash_group_sum(const void *keys, const void *values, int len, Fetch_Type key_type, Fetch_Type value_type,
+                   void *out_keys, double *out_sums);
+
+#endif // HASH_UTILS_H
+
+/* hash_utils.h */
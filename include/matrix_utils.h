@@ -0,0 +1,244 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : matrix_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      matrix_utils.c specifically.
+ */
+
+#ifndef MATRIX_UTILS_H
+#define MATRIX_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <stats_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: fetch_matrix() returns a void ** of separately allocated rows,
+ * so walking a column chases one pointer and misses the cache once per
+ * element. A Utils_Matrix keeps every row in one block instead, which
+ * lets column work be turned into row work with a fast transpose. Use
+ * matrix_from_rows() to convert, and matrix_row_pointers() to hand a
+ * Utils_Matrix to print_matrix() or the stats_reduce_ functions.
+ */
+
+/* [ Macros ] */
+
+#define MATRIX_LEAF (64)    // sub-blocks at most this many rows and columns are transposed tile by tile
+
+/* [ Structs ] */
+
+typedef struct
+{
+    void *data;         // rows * cols elements, row after row, 64-byte aligned
+    int rows;           // number of rows
+    int cols;           // number of columns
+    Fetch_Type type;    // type of the elements
+} Utils_Matrix;
+
+/* [ Functions ] */
+
+/*
+ * Function: matrix_init()
+ * ----------------------
+ * Description:
+ *      Allocates an uninitialized contiguous matrix.
+ *
+ * Arguments:
+ *      - matrix    : The matrix to allocate.
+ *      - rows      : Number of rows.
+ *      - cols      : Number of columns.
+ *      - type      : The data type of the elements.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation, release it with matrix_free().
+ */
+int matrix_init(Utils_Matrix *matrix, int rows, int cols, Fetch_Type type);
+
+/*
+ * Function: matrix_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a matrix.
+ *
+ * Arguments:
+ *      - matrix    : The matrix to release.
+ *
+ * Returns: -
+ */
+void matrix_free(Utils_Matrix *matrix);
+
+/*
+ * Function: matrix_from_rows()
+ * ----------------------
+ * Description:
+ *      Copies a matrix of separate rows, such as the output of
+ *      fetch_matrix(), into a new contiguous matrix.
+ *
+ * Arguments:
+ *      - matrix    : The matrix to create.
+ *      - rows_ptr  : The rows to copy.
+ *      - rows      : Number of rows.
+ *      - cols      : Number of columns.
+ *      - type      : The data type of the elements.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation, release it with matrix_free().
+ */
+int matrix_from_rows(Utils_Matrix *matrix, void **rows_ptr, int rows, int cols, Fetch_Type type);
+
+/*
+ * Function: matrix_row_pointers()
+ * ----------------------
+ * Description:
+ *      Fills an array with a pointer to every row of the matrix, for the
+ *      functions taking a void ** matrix. Nothing is copied.
+ *
+ * Arguments:
+ *      - matrix    : The matrix.
+ *      - rows_ptr  : Buffer of matrix->rows pointers.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments.
+ */
+int matrix_row_pointers(const Utils_Matrix *matrix, void **rows_ptr);
+
+/*
+ * Function: matrix_transpose()
+ * ----------------------
+ * Description:
+ *      Writes the transpose of src into dst. The matrix is split in
+ *      halves along its longer side until the pieces are at most
+ *      MATRIX_LEAF square, so every level of cache is used well whatever
+ *      its size (cache-oblivious). Pieces are then transposed in 8x8
+ *      tiles of 32-bit elements or 4x4 tiles of 64-bit elements, in AVX2
+ *      registers when the CPU supports it.
+ *
+ * Arguments:
+ *      - dst   : A matrix of src->cols rows and src->rows columns of the
+ *                same type, from matrix_init().
+ *      - src   : The matrix to transpose.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or mismatched shapes.
+ *
+ * Notes:
+ *      - dst and src must not overlap.
+ */
+int matrix_transpose(Utils_Matrix *dst, const Utils_Matrix *src);
+
+/*
+ * Function: matrix_columns()
+ * ----------------------
+ * Description:
+ *      Copies consecutive columns out as contiguous arrays, one after
+ *      the other, using the same tiled transpose.
+ *
+ * Arguments:
+ *      - matrix    : The matrix.
+ *      - first     : Index of the first column.
+ *      - count     : Number of columns.
+ *      - out       : Buffer of count * matrix->rows elements; column
+ *                    first + k starts at element k * matrix->rows.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments.
+ */
+int matrix_columns(const Utils_Matrix *matrix, int first, int count, void *out);
+
+/*
+ * Function: matrix_column()
+ * ----------------------
+ * Description:
+ *      matrix_columns() for a single column.
+ *
+ * Arguments:
+ *      - matrix    : The matrix.
+ *      - col       : Index of the column.
+ *      - out       : Buffer of matrix->rows elements.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments.
+ */
+int matrix_column(const Utils_Matrix *matrix, int col, void *out);
+
+/*
+ * Function: matrix_sort_rows()
+ * ----------------------
+ * Description:
+ *      Sorts every row in ascending order, in place.
+ *
+ * Arguments:
+ *      - matrix    : The matrix to sort.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments.
+ */
+int matrix_sort_rows(Utils_Matrix *matrix);
+
+/*
+ * Function: matrix_sort_cols()
+ * ----------------------
+ * Description:
+ *      Sorts every column in ascending order, in place. The matrix is
+ *      transposed into a scratch block, whose rows are sorted, then
+ *      transposed back, so no sort ever walks memory with a stride.
+ *
+ * Arguments:
+ *      - matrix    : The matrix to sort.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int matrix_sort_cols(Utils_Matrix *matrix);
+
+/*
+ * Function: matrix_reduce_rows() / matrix_reduce_cols()
+ * ----------------------
+ * Description:
+ *      stats_reduce_rows() and stats_reduce_cols() on a contiguous
+ *      matrix. Rows are read in memory order in both cases.
+ *
+ * Arguments:
+ *      - matrix    : The matrix to reduce.
+ *      - op        : The reduction to apply.
+ *      - out       : Caller-provided array of matrix->rows (or ->cols) results.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int matrix_reduce_rows(const Utils_Matrix *matrix, Stats_Op op, double *out);
+int matrix_reduce_cols(const Utils_Matrix *matrix, Stats_Op op, double *out);
+
+#endif // MATRIX_UTILS_H
+
+/* matrix_utils.h */
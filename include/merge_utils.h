@@ -0,0 +1,103 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : merge_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      merge_utils.c specifically.
+ */
+
+#ifndef MERGE_UTILS_H
+#define MERGE_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <context_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/* [ Macros ] */
+
+#define MERGE_PARALLEL_MIN (1 << 16)    // fewest output elements worth giving a thread of its own
+
+/* [ Structs ] */
+
+typedef struct
+{
+    const void *data;   // sorted array
+    int len;            // number of elements in it
+} Merge_Run;
+
+/* [ Functions ] */
+
+/*
+ * Function: merge_k()
+ * ----------------------
+ * Description:
+ *      Merges k sorted arrays of the same type into one sorted output in
+ *      a single pass. The smallest head element is kept at the top of a
+ *      loser tree, so each output element costs about log2(k) comparisons
+ *      no matter how many runs there are, where repeated pairwise merge()
+ *      calls would copy every element log2(k) times.
+ *
+ *      With more than one thread, the output is cut into equal slices
+ *      and each thread co-ranks its slice boundaries (finds how many
+ *      elements of every run land before them) with binary searches,
+ *      then merges its slice independently of the others.
+ *
+ * Arguments:
+ *      - dst       : Output array with room for the sum of the run lengths.
+ *      - runs      : The k runs, each sorted in ascending order.
+ *      - k         : Number of runs.
+ *      - type      : The data type of every run and of dst.
+ *      - threads   : Number of threads to merge with, 0 for one per online
+ *                    CPU, 1 to stay on the calling thread.
+ *
+ * Returns:
+ *      The number of elements written to dst, or -1 on invalid arguments,
+ *      allocation failure or if the total does not fit in an int.
+ *
+ * Notes:
+ *      - The merge is stable: equal elements keep the order of their runs.
+ *      - Outputs shorter than MERGE_PARALLEL_MIN per thread use fewer threads.
+ *      - dst must not overlap any run.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int merge_k(void *dst, const Merge_Run *runs, int k, Fetch_Type type, int threads);
+
+/*
+ * Function: merge_k_ctx()
+ * ----------------------
+ * Description:
+ *      merge_k() allocating its scratch memory and logging errors
+ *      through the context. The allocator is only called from the
+ *      calling thread.
+ *
+ * Arguments:
+ *      - ctx     : The context to allocate and log through.
+ *      - (others): As for merge_k().
+ *
+ * Returns:
+ *      As for merge_k().
+ */
+int merge_k_ctx(Utils_Context *ctx, void *dst, const Merge_Run *runs, int k, Fetch_Type type, int threads);
+
+#endif // MERGE_UTILS_H
+
+/* merge_utils.h */
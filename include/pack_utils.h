@@ -0,0 +1,205 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : pack_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      pack_utils.c specifically.
+ */
+
+#ifndef PACK_UTILS_H
+#define PACK_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <stdint.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: A Pack_Array stores a sorted TYPE_INT, TYPE_LONG or
+ * TYPE_LONG_LONG array in blocks of PACK_BLOCK values. Each block keeps
+ * its first value and the differences between neighbours, bit-packed
+ * with as many bits as its largest difference needs. The differences
+ * are interleaved over PACK_LANES 32-bit lanes, so eight of them are
+ * unpacked per AVX2 instruction. Dense ID lists typically shrink 4-8x.
+ *
+ * Every block also has a skip entry holding its first value, so lookups
+ * binary search the skip entries and decode one block only, and
+ * intersections jump over whole blocks without decoding them.
+ */
+
+/* [ Macros ] */
+
+#define PACK_BLOCK (128)    // values per block
+#define PACK_LANES (8)      // 32-bit lanes the differences are interleaved over
+#define PACK_RAW (64)       // bits of a block whose differences do not fit in 32 bits
+
+/* [ Structs ] */
+
+/*
+ * Pack_Skip
+ * ----------------------
+ * Description:
+ *      Where a block starts and how it is packed.
+ */
+typedef struct
+{
+    long long first;    // first value of the block
+    uint32_t row;       // first row of PACK_LANES words of the block
+    uint8_t bits;       // bits per difference, 0 to 32, or PACK_RAW
+} Pack_Skip;
+
+typedef struct
+{
+    Pack_Skip *skips;   // one entry per block
+    uint32_t *words;    // packed differences of every block
+    size_t rows;        // number of rows of PACK_LANES words
+    int blocks;         // number of blocks
+    int len;            // number of values
+    Fetch_Type type;    // type of the values
+} Pack_Array;
+
+/* [ Functions ] */
+
+/*
+ * Function: pack_build()
+ * ----------------------
+ * Description:
+ *      Compresses a sorted integer array.
+ *
+ * Arguments:
+ *      - pack  : The compressed array to build.
+ *      - arr   : The array, sorted in ascending order.
+ *      - len   : Number of elements in the array.
+ *      - type  : TYPE_INT, TYPE_LONG or TYPE_LONG_LONG.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments, a floating-point type, an
+ *      unsorted array or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation, release it with pack_free(), which is also
+ *      safe after a failed build.
+ */
+int pack_build(Pack_Array *pack, const void *arr, int len, Fetch_Type type);
+
+/*
+ * Function: pack_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a compressed array.
+ *
+ * Arguments:
+ *      - pack  : The compressed array to release.
+ *
+ * Returns: -
+ */
+void pack_free(Pack_Array *pack);
+
+/*
+ * Function: pack_bytes()
+ * ----------------------
+ * Description:
+ *      Returns the memory used by the blocks and skip entries.
+ *
+ * Arguments:
+ *      - pack  : The compressed array.
+ *
+ * Returns:
+ *      The size in bytes.
+ */
+size_t pack_bytes(const Pack_Array *pack);
+
+/*
+ * Function: pack_decode()
+ * ----------------------
+ * Description:
+ *      Decompresses the whole array, using AVX2 to unpack the
+ *      differences when the CPU supports it.
+ *
+ * Arguments:
+ *      - pack  : The compressed array.
+ *      - dst   : Buffer of pack->len elements of pack->type.
+ *
+ * Returns:
+ *      The number of elements written, or -1 on invalid arguments.
+ */
+int pack_decode(const Pack_Array *pack, void *dst);
+
+/*
+ * Function: pack_get()
+ * ----------------------
+ * Description:
+ *      Reads one element, decoding only the block that holds it.
+ *
+ * Arguments:
+ *      - pack  : The compressed array.
+ *      - index : Position of the element.
+ *      - value : Receives the element, of pack->type.
+ *
+ * Returns:
+ *      0 on success, -1 if the index is out of range.
+ *
+ * Notes:
+ *      - Decodes PACK_BLOCK values per call: read ranges with
+ *      pack_decode() instead.
+ */
+int pack_get(const Pack_Array *pack, int index, void *value);
+
+/*
+ * Function: pack_lower_bound()
+ * ----------------------
+ * Description:
+ *      Finds the first element that is not less than the key, binary
+ *      searching the skip entries and decoding a single block.
+ *
+ * Arguments:
+ *      - pack  : The compressed array.
+ *      - key   : Pointer to the value to look for, of pack->type.
+ *
+ * Returns:
+ *      The index of the element, pack->len if every element is less
+ *      than the key, or -1 on invalid arguments.
+ */
+int pack_lower_bound(const Pack_Array *pack, const void *key);
+
+/*
+ * Function: pack_intersection()
+ * ----------------------
+ * Description:
+ *      Writes the elements present in both compressed arrays, like
+ *      set_intersection() does for plain ones. Whenever one side is
+ *      behind, it jumps straight to the block that may hold the other
+ *      side's value, so blocks with nothing in common are never decoded.
+ *
+ * Arguments:
+ *      - dst   : Buffer of at least min(a->len, b->len) elements.
+ *      - a     : First compressed array.
+ *      - b     : Second compressed array, of the same type.
+ *
+ * Returns:
+ *      The number of elements written, or -1 on invalid arguments.
+ *
+ * Notes:
+ *      - Duplicates are kept as many times as they appear in both.
+ */
+int pack_intersection(void *dst, const Pack_Array *a, const Pack_Array *b);
+
+#endif // PACK_UTILS_H
+
+/* pack_utils.h */
@@ -0,0 +1,193 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : perf_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      perf_utils.c specifically.
+ */
+
+#ifndef PERF_UTILS_H
+#define PERF_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <context_utils.h>
+#include <stdint.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: These functions measure a region of code with the hardware
+ * counters of the CPU, through perf_event_open() on Linux. Only the
+ * calling thread is counted, in user space only, so they work with the
+ * default perf_event_paranoid setting of 2. Counters the kernel or the
+ * CPU refuses (containers, virtual machines, a stricter paranoid level)
+ * are simply left out: the wall-clock time is always measured, and page
+ * faults fall back to getrusage().
+ */
+
+/* [ Macros ] */
+
+#define PERF_EVENTS (6) // number of Perf_Event values
+
+/* [ Enums ] */
+
+typedef enum
+{
+    PERF_CYCLES,            // CPU cycles
+    PERF_INSTRUCTIONS,      // instructions retired
+    PERF_BRANCH_MISSES,     // mispredicted branches
+    PERF_L1D_MISSES,        // L1 data cache read misses
+    PERF_LLC_MISSES,        // last level cache misses
+    PERF_PAGE_FAULTS,       // minor and major page faults
+} Perf_Event;
+
+/* [ Structs ] */
+
+typedef struct
+{
+    double seconds;                 // wall-clock time of the region
+    uint64_t values[PERF_EVENTS];   // counts, scaled up if the counter was multiplexed
+    bool valid[PERF_EVENTS];        // whether each count was measured
+} Perf_Sample;
+
+typedef struct
+{
+    int fds[PERF_EVENTS];   // counter descriptors, -1 for those unavailable
+    double start;           // clock at perf_start()
+    long faults;            // getrusage() page faults at perf_start()
+} Perf_Counters;
+
+/* [ Functions ] */
+
+/*
+ * Function: perf_open()
+ * ----------------------
+ * Description:
+ *      Opens every counter the system allows for the calling thread,
+ *      without starting them.
+ *
+ * Arguments:
+ *      - pc    : The counters to open.
+ *
+ * Returns:
+ *      The number of hardware and kernel counters opened, between 0
+ *      and PERF_EVENTS. With 0, samples only hold the wall-clock time
+ *      and the page faults.
+ *
+ * Notes:
+ *      - Logs a warning once per process if no counter could be opened.
+ *      - Counters follow the thread that opened them: start, stop and
+ *      close them on that thread.
+ */
+int perf_open(Perf_Counters *pc);
+
+/*
+ * Function: perf_start()
+ * ----------------------
+ * Description:
+ *      Resets and starts the counters at the beginning of a region.
+ *
+ * Arguments:
+ *      - pc    : Counters opened by perf_open().
+ *
+ * Returns: -
+ */
+void perf_start(Perf_Counters *pc);
+
+/*
+ * Function: perf_stop()
+ * ----------------------
+ * Description:
+ *      Stops the counters at the end of a region and reads them.
+ *
+ * Arguments:
+ *      - pc        : Counters started by perf_start().
+ *      - sample    : Receives the time and the counts of the region.
+ *
+ * Returns: -
+ *
+ * Notes:
+ *      - When the kernel had to share a hardware counter between events,
+ *      the count is scaled by the fraction of the region it ran for.
+ */
+void perf_stop(Perf_Counters *pc, Perf_Sample *sample);
+
+/*
+ * Function: perf_close()
+ * ----------------------
+ * Description:
+ *      Closes the counters.
+ *
+ * Arguments:
+ *      - pc    : Counters opened by perf_open().
+ *
+ * Returns: -
+ */
+void perf_close(Perf_Counters *pc);
+
+/*
+ * Function: perf_event_name()
+ * ----------------------
+ * Description:
+ *      Returns the short name of an event, e.g. "branch-misses".
+ *
+ * Arguments:
+ *      - event : The event.
+ *
+ * Returns:
+ *      The name, or "?" for an unexpected event.
+ */
+const char *perf_event_name(Perf_Event event);
+
+/*
+ * Function: perf_report()
+ * ----------------------
+ * Description:
+ *      Prints one line for a measured case: its time, every counter it
+ *      has, and the instructions per cycle when both were measured.
+ *
+ * Arguments:
+ *      - name      : Name of the case.
+ *      - sample    : Its sample.
+ *
+ * Returns: -
+ *
+ * Example:
+ *      quick_sort 1M: 61.204 ms | cycles 183.4M | instructions 402.9M (2.20 IPC) | ...
+ */
+void perf_report(const char *name, const Perf_Sample *sample);
+
+/*
+ * Function: perf_report_ctx()
+ * ----------------------
+ * Description:
+ *      perf_report() on an explicit context, written as one record.
+ *
+ * Arguments:
+ *      - ctx       : The context to print through.
+ *      - name      : Name of the case.
+ *      - sample    : Its sample.
+ *
+ * Returns: -
+ */
+void perf_report_ctx(Utils_Context *ctx, const char *name, const Perf_Sample *sample);
+
+#endif // PERF_UTILS_H
+
+/* perf_utils.h */
@@ -16,6 +16,7 @@
 
 /* [ Headers ] */
 #include <custom_utils.h>
+#include <context_utils.h>
 
 /* 
  * [WARNING]: Your IDE might not find the file, so you might have to 
@@ -29,6 +30,15 @@
  * will only have a shortened description for code clarity.
  */
 
+/*
+ * [INFO]: How arrays and matrices are laid out is read from the print
+ * field of the context. The functions without the _ctx suffix use the
+ * calling thread's default context, so for those, set for instance
+ * context_default()->print.max_elements = 20 to print huge arrays as
+ * "{ 1, 2, 3, ..., 98, 99, 100 }". Only the elements that are shown are
+ * ever formatted, so printing cost no longer grows with the array.
+ */
+
 /* [ Structs ] */
 
 typedef enum
@@ -102,6 +112,20 @@ static inline void print_type_determ(void* arr, Fetch_Type type, int idx)
  */
 void print_divider(size_t len, Char_Type divider);
 
+/*
+ * Function: print_divider_ctx()
+ * ----------------------
+ * Description:
+ *      print_divider() writing to ctx->out as a single record.
+ *
+ * Arguments:
+ *      - ctx       : The context to print through.
+ *      - len       : The length of the divider.
+ *      - divider   : The character that will compose the divider.
+ * Returns: -
+ */
+void print_divider_ctx(Utils_Context *ctx, size_t len, Char_Type divider);
+
 /*
  * Function: print_array()
  * ----------------------
@@ -117,9 +141,77 @@ void print_divider(size_t len, Char_Type divider);
  * 
  * Notes:
  *      - Leave msg blank for no message.
+ *      - Prints at most print.max_elements elements of the default
+ *      context, eliding the middle of the array with "...".
  */
 void print_array(void *arr, int len, const char *msg, Fetch_Type type);
 
+/*
+ * Function: print_array_ctx()
+ * ----------------------
+ * Description:
+ *      print_array() on an explicit context. The whole array is formatted
+ *      into the context's buffer and written to ctx->out as one record,
+ *      so output from several threads never interleaves mid-array.
+ *
+ * Arguments:
+ *      - ctx       : The context to print through.
+ *      - arr[]     : The array to print.
+ *      - len       : Length of the array.
+ *      - msg       : Message given to the user.
+ *      - type      : The data type of the array.
+ *
+ * Returns: -
+ *
+ * Notes:
+ *      - Colour codes are only emitted when ctx->color is set.
+ */
+void print_array_ctx(Utils_Context *ctx, const void *arr, int len, const char *msg, Fetch_Type type);
+
+/*
+ * Function: print_array_<type>()
+ * ----------------------
+ * Description:
+ *      Type-specialized versions of print_array(). The loop only handles
+ *      one type, so the compiler can inline the formatting and there is
+ *      no switch per element. print_array() forwards to these.
+ *
+ * Arguments:
+ *      - arr[]     : The array to print.
+ *      - len       : Length of the array.
+ *      - msg       : Message given to the user.
+ *
+ * Returns: -
+ */
+void print_array_int(const int *arr, int len, const char *msg);
+void print_array_long(const long *arr, int len, const char *msg);
+void print_array_long_long(const long long *arr, int len, const char *msg);
+void print_array_float(const float *arr, int len, const char *msg);
+void print_array_double(const double *arr, int len, const char *msg);
+
+/*
+ * PRINT_ARRAY()
+ * ----------------------
+ * Description:
+ *      Picks the typed print_array_<type>() from the array's type
+ *      at compile time.
+ *
+ * Example:
+ *      double values[3] = { 1.0, 2.0, 3.0 };
+ *      PRINT_ARRAY(values, 3, "Values:");
+ */
+#define PRINT_ARRAY(arr, len, msg) _Generic((arr),      \
+        int *: print_array_int,                         \
+        const int *: print_array_int,                   \
+        long *: print_array_long,                       \
+        const long *: print_array_long,                 \
+        long long *: print_array_long_long,             \
+        const long long *: print_array_long_long,       \
+        float *: print_array_float,                     \
+        const float *: print_array_float,               \
+        double *: print_array_double,                   \
+        const double *: print_array_double)(arr, len, msg)
+
 /*
  * print_matrix()
  * ----------------------
@@ -138,6 +230,32 @@ void print_array(void *arr, int len, const char *msg, Fetch_Type type);
  */
 void print_matrix(void **matrix, int rows, int cols, const char *msg, Fetch_Type type);
 
+/*
+ * print_matrix_ctx()
+ * ----------------------
+ * Description:
+ *      print_matrix() on an explicit context, the whole matrix being
+ *      written as one record.
+ *
+ * Arguments:
+ *      - ctx       : The context to print through.
+ *      - matrix[][]: The matrix to print.
+ *      - rows      : Number of rows.
+ *      - cols      : Number of columns.
+ *      - msg       : Message given to the user.
+ *      - type      : Type of data to fetch.
+ *
+ * Return: -
+ *
+ * Notes:
+ *      - Shows at most ctx->print.max_rows rows and max_elements columns,
+ *      eliding the middle ones.
+ *      - With ctx->print.align, columns are padded to their widest shown
+ *      value. The widths are measured from the shown rows only and use
+ *      the context's allocator; without memory, rows are left unaligned.
+ */
+void print_matrix_ctx(Utils_Context *ctx, void **matrix, int rows, int cols, const char *msg, Fetch_Type type);
+
 /*
  * Function: print_progress_bar()
  * ----------------------
@@ -155,6 +273,21 @@ void print_matrix(void **matrix, int rows, int cols, const char *msg, Fetch_Type
  */
 void print_progress_bar(int progress, int total, int width, Char_Type fill_complete, Char_Type fill_remaining);
 
+/*
+ * Function: print_progress_bar_ctx()
+ * ----------------------
+ * Description:
+ *      print_progress_bar() on an explicit context. ctx->out is flushed
+ *      after the bar is written.
+ *
+ * Arguments:
+ *      - ctx           : The context to print through.
+ *      - (others)      : As for print_progress_bar().
+ *
+ * Return: -
+ */
+void print_progress_bar_ctx(Utils_Context *ctx, int progress, int total, int width, Char_Type fill_complete, Char_Type fill_remaining);
+
 /*
  * Function: print_log()
  * ----------------------
@@ -169,6 +302,24 @@ void print_progress_bar(int progress, int total, int width, Char_Type fill_compl
  */
 void print_log(const char *prefix, Color color, const char *format, ...);
 
+/*
+ * Function: print_log_ctx()
+ * ----------------------
+ * Description:
+ *      print_log() on an explicit context, writing the whole message to
+ *      ctx->err as one record.
+ *
+ * Arguments:
+ *      - ctx   : The context to log through.
+ *      - prefix: Tag printed before the message when color.fg_color is set.
+ *      - color : Colour of the prefix and message.
+ *      - format: A string containing the format specification for the log message.
+ *      - ...   : Additional arguments that match the format placeholders.
+ *
+ * Return: -
+ */
+void print_log_ctx(Utils_Context *ctx, const char *prefix, Color color, const char *format, ...);
+
 #endif // PRINT_UTILS_H
 
 /* print_utils.h */
\ No newline at end of file
@@ -0,0 +1,117 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : scan_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      scan_utils.c specifically.
+ */
+
+#ifndef SCAN_UTILS_H
+#define SCAN_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: A scan (prefix sum) replaces every element with the sum of the
+ * elements up to it (inclusive) or before it (exclusive). Integer sums
+ * wrap around on overflow instead of being undefined. Floating-point sums
+ * are added in a different order than a plain loop would, eight at a time
+ * and block by block, so their last digits may differ from one.
+ */
+
+/* [ Macros ] */
+
+#define SCAN_PARALLEL_MIN (1 << 18)     // fewest elements worth giving a thread of its own
+#define SCAN_MAX_THREADS (64)           // most threads a single scan uses
+
+/* [ Enums ] */
+
+typedef enum
+{
+    SCAN_INCLUSIVE,     // dst[i] = src[0] + ... + src[i]
+    SCAN_EXCLUSIVE,     // dst[i] = src[0] + ... + src[i - 1], dst[0] = 0
+} Scan_Mode;
+
+/* [ Functions ] */
+
+/*
+ * Function: scan()
+ * ----------------------
+ * Description:
+ *      Computes the prefix sums of an array. Each block of eight (or
+ *      four, for 64-bit types) elements is summed in registers with AVX2
+ *      when the CPU supports it.
+ *
+ *      With more than one thread, the array is cut into one block per
+ *      thread: every thread scans its block on its own, then adds the
+ *      total of the blocks before it once those are known.
+ *
+ * Arguments:
+ *      - dst       : Output array of len elements, may be src.
+ *      - src       : The array to scan.
+ *      - len       : Number of elements.
+ *      - type      : The data type of both arrays.
+ *      - mode      : SCAN_INCLUSIVE or SCAN_EXCLUSIVE.
+ *      - threads   : Number of threads to scan with, 0 for one per online
+ *                    CPU, 1 to stay on the calling thread.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments.
+ *
+ * Notes:
+ *      - Arrays shorter than SCAN_PARALLEL_MIN per thread use fewer threads.
+ *
+ * Example:
+ *      int counts[4] = { 3, 1, 4, 1 }, offsets[4];
+ *      scan(offsets, counts, 4, TYPE_INT, SCAN_EXCLUSIVE, 1);  // { 0, 3, 4, 8 }
+ */
+int scan(void *dst, const void *src, int len, Fetch_Type type, Scan_Mode mode, int threads);
+
+/*
+ * Function: scan_segmented()
+ * ----------------------
+ * Description:
+ *      scan() restarting the sum at every element flagged in heads, so
+ *      that each segment is scanned on its own. Blocks are split between
+ *      threads the same way, a block only adding the total of the blocks
+ *      before it up to its first head.
+ *
+ * Arguments:
+ *      - dst       : Output array of len elements, may be src.
+ *      - src       : The array to scan.
+ *      - heads     : len flags, true where a new segment starts.
+ *      - len       : Number of elements.
+ *      - type      : The data type of both arrays.
+ *      - mode      : SCAN_INCLUSIVE or SCAN_EXCLUSIVE.
+ *      - threads   : As for scan().
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments.
+ *
+ * Notes:
+ *      - The first element always starts a segment, flagged or not.
+ *      - The segmented kernel is scalar.
+ */
+int scan_segmented(void *dst, const void *src, const bool *heads, int len, Fetch_Type type, Scan_Mode mode, int threads);
+
+#endif // SCAN_UTILS_H
+
+/* scan_utils.h */
@@ -0,0 +1,277 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : search_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      search_utils.c specifically.
+ */
+
+#ifndef SEARCH_UTILS_H
+#define SEARCH_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: Every search expects an array sorted in ascending order, such as
+ * the output of quick_sort() or merge_sort(). Keys are passed by pointer and
+ * must have the same type as the array elements.
+ */
+
+/* [ Structs ] */
+
+/*
+ * Search_Index
+ * ----------------------
+ * Description:
+ *      A copy of a sorted array stored in Eytzinger (BFS) order. The first
+ *      levels of the implicit tree share a handful of cache lines, and the
+ *      children of a node are adjacent, so lookups can prefetch several
+ *      levels ahead.
+ */
+typedef struct
+{
+    void *data;         // elements in BFS order, 1-indexed
+    int *ranks;         // position of every BFS slot in the sorted array
+    int len;            // number of elements
+    Fetch_Type type;    // type of the elements
+} Search_Index;
+
+/* [ Functions ] */
+
+/*
+ * Function: search_lower_bound()
+ * ----------------------
+ * Description:
+ *      Finds the first element that is not less than the key,
+ *      using a classic binary search.
+ *
+ * Arguments:
+ *      - arr   : The sorted array to search.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *      - key   : Pointer to the value to look for.
+ *
+ * Returns:
+ *      The index of the element, len if every element is less than
+ *      the key, or -1 on invalid arguments.
+ */
+int search_lower_bound(const void *arr, int len, Fetch_Type type, const void *key);
+
+/*
+ * Function: search_upper_bound()
+ * ----------------------
+ * Description:
+ *      Finds the first element that is greater than the key,
+ *      using a classic binary search.
+ *
+ * Arguments:
+ *      - arr   : The sorted array to search.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *      - key   : Pointer to the value to look for.
+ *
+ * Returns:
+ *      The index of the element, len if no element is greater than
+ *      the key, or -1 on invalid arguments.
+ */
+int search_upper_bound(const void *arr, int len, Fetch_Type type, const void *key);
+
+/*
+ * Function: search_equal_range()
+ * ----------------------
+ * Description:
+ *      Finds the range of elements equal to the key.
+ *
+ * Arguments:
+ *      - arr   : The sorted array to search.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *      - key   : Pointer to the value to look for.
+ *      - first : Where the index of the first equal element is stored.
+ *      - last  : Where the index past the last equal element is stored.
+ *
+ * Returns:
+ *      The number of equal elements, or -1 on invalid arguments.
+ */
+int search_equal_range(const void *arr, int len, Fetch_Type type, const void *key, int *first, int *last);
+
+/*
+ * Function: search_lower_bound_branchless()
+ * ----------------------
+ * Description:
+ *      Same as search_lower_bound(), but the loop has a fixed trip count
+ *      and selects the next half with a conditional move, so it never
+ *      mispredicts.
+ *
+ * Arguments:
+ *      - arr   : The sorted array to search.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *      - key   : Pointer to the value to look for.
+ *
+ * Returns:
+ *      The same as search_lower_bound().
+ */
+int search_lower_bound_branchless(const void *arr, int len, Fetch_Type type, const void *key);
+
+/*
+ * Function: search_upper_bound_branchless()
+ * ----------------------
+ * Description:
+ *      Same as search_upper_bound(), without branches in the loop.
+ *
+ * Arguments:
+ *      - arr   : The sorted array to search.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *      - key   : Pointer to the value to look for.
+ *
+ * Returns:
+ *      The same as search_upper_bound().
+ */
+int search_upper_bound_branchless(const void *arr, int len, Fetch_Type type, const void *key);
+
+/*
+ * Function: search_lower_bound_prefetch()
+ * ----------------------
+ * Description:
+ *      Branchless lower bound that prefetches both possible midpoints of
+ *      the next step, overlapping the next cache miss with the current one.
+ *      Pays off on arrays much larger than the last-level cache.
+ *
+ * Arguments:
+ *      - arr   : The sorted array to search.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *      - key   : Pointer to the value to look for.
+ *
+ * Returns:
+ *      The same as search_lower_bound().
+ */
+int search_lower_bound_prefetch(const void *arr, int len, Fetch_Type type, const void *key);
+
+/*
+ * Function: search_lower_bound_batch()
+ * ----------------------
+ * Description:
+ *      Runs many lower bound queries at once. Groups of queries advance
+ *      through the array in lockstep, so the cache misses of one query are
+ *      hidden behind the work of the others.
+ *
+ * Arguments:
+ *      - arr       : The sorted array to search.
+ *      - len       : Number of elements in the array.
+ *      - type      : The data type of the array and the keys.
+ *      - keys      : Array of keys to look for.
+ *      - key_cnt   : Number of keys.
+ *      - out       : Caller-provided array of key_cnt results.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments.
+ */
+int search_lower_bound_batch(const void *arr, int len, Fetch_Type type, const void *keys, int key_cnt, int *out);
+
+/*
+ * Function: search_index_build()
+ * ----------------------
+ * Description:
+ *      Builds an Eytzinger index from a sorted array.
+ *
+ * Arguments:
+ *      - index : The index to build.
+ *      - arr   : The sorted array to index (it is copied), NULL if len is 0.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation, release it with search_index_free().
+ */
+int search_index_build(Search_Index *index, const void *arr, int len, Fetch_Type type);
+
+/*
+ * Function: search_index_lower_bound()
+ * ----------------------
+ * Description:
+ *      Finds the first element that is not less than the key.
+ *
+ * Arguments:
+ *      - index : The index to search.
+ *      - key   : Pointer to the value to look for.
+ *
+ * Returns:
+ *      The index of the element in the original sorted array, or len
+ *      if every element is less than the key.
+ */
+int search_index_lower_bound(const Search_Index *index, const void *key);
+
+/*
+ * Function: search_index_upper_bound()
+ * ----------------------
+ * Description:
+ *      Finds the first element that is greater than the key.
+ *
+ * Arguments:
+ *      - index : The index to search.
+ *      - key   : Pointer to the value to look for.
+ *
+ * Returns:
+ *      The index of the element in the original sorted array, or len
+ *      if no element is greater than the key.
+ */
+int search_index_upper_bound(const Search_Index *index, const void *key);
+
+/*
+ * Function: search_index_lower_bound_batch()
+ * ----------------------
+ * Description:
+ *      Runs many lower bound queries against an index, interleaving
+ *      them to hide memory latency.
+ *
+ * Arguments:
+ *      - index     : The index to search.
+ *      - keys      : Array of keys, of the same type as the index.
+ *      - key_cnt   : Number of keys.
+ *      - out       : Caller-provided array of key_cnt results.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments.
+ */
+int search_index_lower_bound_batch(const Search_Index *index, const void *keys, int key_cnt, int *out);
+
+/*
+ * Function: search_index_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by an index.
+ *
+ * Arguments:
+ *      - index : The index to release.
+ *
+ * Returns: -
+ */
+void search_index_free(Search_Index *index);
+
+#endif // SEARCH_UTILS_H
+
+/* search_utils.h */
@@ -0,0 +1,326 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : sketch_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      sketch_utils.c specifically.
+ */
+
+#ifndef SKETCH_UTILS_H
+#define SKETCH_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <stdint.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: Sketches summarize a stream of any length in a fixed amount of
+ * memory, at the cost of approximate answers. Sketch_Kll answers
+ * quantile and rank queries (the median, the 99th percentile, ...) and
+ * Sketch_Hll counts distinct values. Both can be merged, so every
+ * thread or input file can fill its own sketch and the results be
+ * combined afterwards with the same accuracy as a single sketch.
+ */
+
+/* [ Macros ] */
+
+#define SKETCH_KLL_DEFAULT_K (200)  // KLL accuracy parameter, about 1% rank error
+#define SKETCH_KLL_MIN_K (8)        // smallest accepted k, and smallest level capacity
+#define SKETCH_KLL_LEVELS (48)      // most compaction levels, enough for 2^47 times k values
+#define SKETCH_HLL_DEFAULT_P (14)   // HyperLogLog precision, 16 KiB and about 0.8% error
+#define SKETCH_HLL_MIN_P (4)        // smallest accepted precision
+#define SKETCH_HLL_MAX_P (18)       // largest accepted precision
+
+/* [ Structs ] */
+
+/*
+ * Sketch_Kll
+ * ----------------------
+ * Description:
+ *      A KLL quantile sketch. Values enter level 0. Once the sketch
+ *      holds more values than its levels' capacities add up to, the
+ *      lowest full level is sorted and every other value, starting at
+ *      a random one of the first two, is promoted to the level above,
+ *      where each value stands for twice as many. The top level holds
+ *      k values and each lower level 2/3 as many, at least
+ *      SKETCH_KLL_MIN_K, so the sketch keeps at most about 3k values plus
+ *      SKETCH_KLL_MIN_K per level, with log2(n / k) levels: 500 to 620
+ *      values over 13 levels for k = 200 and 1M values. Each sketch
+ *      draws its own random choices, so errors of merged sketches
+ *      cancel out rather than add up.
+ */
+typedef struct
+{
+    double *items[SKETCH_KLL_LEVELS];   // values of every level, in no order
+    int lens[SKETCH_KLL_LEVELS];        // number of values in every level
+    int sizes[SKETCH_KLL_LEVELS];       // allocated room of every level
+    int widths[SKETCH_KLL_LEVELS];      // capacity of every level
+    int levels;                         // number of levels in use
+    int k;                              // capacity of the top level
+    long long n;                        // number of values summarized
+    double min;                         // smallest value seen
+    double max;                         // largest value seen
+    uint64_t seed;                      // state of the compaction coin
+} Sketch_Kll;
+
+/*
+ * Sketch_Hll
+ * ----------------------
+ * Description:
+ *      A HyperLogLog distinct counter of 2^p one-byte registers. Each
+ *      value is hashed; the first p bits pick a register, which keeps
+ *      the longest run of leading zeros seen in the remaining bits.
+ */
+typedef struct
+{
+    uint8_t *registers; // 2^p registers
+    int p;              // precision
+} Sketch_Hll;
+
+/* [ Functions ] */
+
+/*
+ * Function: sketch_kll_init()
+ * ----------------------
+ * Description:
+ *      Creates an empty quantile sketch.
+ *
+ * Arguments:
+ *      - sketch    : The sketch to create.
+ *      - k         : Accuracy parameter, at least SKETCH_KLL_MIN_K, or 0
+ *                    for SKETCH_KLL_DEFAULT_K. The rank error is about
+ *                    2 / k and the memory about 3k doubles, plus
+ *                    SKETCH_KLL_MIN_K per level (see Sketch_Kll).
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation, release it with sketch_kll_free().
+ */
+int sketch_kll_init(Sketch_Kll *sketch, int k);
+
+/*
+ * Function: sketch_kll_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a quantile sketch.
+ *
+ * Arguments:
+ *      - sketch    : The sketch to release.
+ *
+ * Returns: -
+ */
+void sketch_kll_free(Sketch_Kll *sketch);
+
+/*
+ * Function: sketch_kll_update()
+ * ----------------------
+ * Description:
+ *      Adds one value to a quantile sketch. NaN is ignored.
+ *
+ * Arguments:
+ *      - sketch    : The sketch.
+ *      - value     : The value.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ */
+int sketch_kll_update(Sketch_Kll *sketch, double value);
+
+/*
+ * Function: sketch_kll_add()
+ * ----------------------
+ * Description:
+ *      Adds an array of any type to a quantile sketch, e.g. the output
+ *      of fetch_array(). NaNs are ignored.
+ *
+ * Arguments:
+ *      - sketch    : The sketch.
+ *      - values    : The array.
+ *      - len       : Number of values.
+ *      - type      : The data type of the array.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ */
+int sketch_kll_add(Sketch_Kll *sketch, const void *values, int len, Fetch_Type type);
+
+/*
+ * Function: sketch_kll_merge()
+ * ----------------------
+ * Description:
+ *      Adds everything summarized by one sketch to another.
+ *
+ * Arguments:
+ *      - dst   : The sketch to merge into.
+ *      - src   : The sketch to merge, left unchanged.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Notes:
+ *      - The sketches may use different k; dst keeps its own.
+ */
+int sketch_kll_merge(Sketch_Kll *dst, const Sketch_Kll *src);
+
+/*
+ * Function: sketch_kll_quantile()
+ * ----------------------
+ * Description:
+ *      Estimates the value below which a fraction q of the values lie.
+ *
+ * Arguments:
+ *      - sketch    : The sketch.
+ *      - q         : The fraction, from 0 (the minimum) to 1 (the maximum).
+ *
+ * Returns:
+ *      The estimated quantile, or NAN if the sketch is empty, on invalid
+ *      arguments or on allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+double sketch_kll_quantile(const Sketch_Kll *sketch, double q);
+
+/*
+ * Function: sketch_kll_quantiles()
+ * ----------------------
+ * Description:
+ *      sketch_kll_quantile() for several fractions, sorting the sketch
+ *      only once.
+ *
+ * Arguments:
+ *      - sketch    : The sketch.
+ *      - qs        : Array of fractions, in any order.
+ *      - count     : Number of fractions.
+ *      - out       : Receives the quantile of every fraction.
+ *
+ * Returns:
+ *      0 on success, -1 if the sketch is empty, on invalid arguments or
+ *      on allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int sketch_kll_quantiles(const Sketch_Kll *sketch, const double *qs, int count, double *out);
+
+/*
+ * Function: sketch_kll_rank()
+ * ----------------------
+ * Description:
+ *      Estimates the fraction of the values that are not greater
+ *      than a value.
+ *
+ * Arguments:
+ *      - sketch    : The sketch.
+ *      - value     : The value.
+ *
+ * Returns:
+ *      The fraction from 0 to 1, or NAN if the sketch is empty or on
+ *      invalid arguments.
+ */
+double sketch_kll_rank(const Sketch_Kll *sketch, double value);
+
+/*
+ * Function: sketch_hll_init()
+ * ----------------------
+ * Description:
+ *      Creates an empty distinct counter.
+ *
+ * Arguments:
+ *      - sketch    : The sketch to create.
+ *      - p         : Precision from SKETCH_HLL_MIN_P to SKETCH_HLL_MAX_P,
+ *                    or 0 for SKETCH_HLL_DEFAULT_P. The sketch takes 2^p
+ *                    bytes and its standard error is 1.04 / sqrt(2^p).
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation, release it with sketch_hll_free().
+ */
+int sketch_hll_init(Sketch_Hll *sketch, int p);
+
+/*
+ * Function: sketch_hll_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a distinct counter.
+ *
+ * Arguments:
+ *      - sketch    : The sketch to release.
+ *
+ * Returns: -
+ */
+void sketch_hll_free(Sketch_Hll *sketch);
+
+/*
+ * Function: sketch_hll_add()
+ * ----------------------
+ * Description:
+ *      Adds an array of any type to a distinct counter; pass len 1 for
+ *      a single value. Integers are hashed by value whatever their type,
+ *      and so are floats and doubles, with 0.0 and -0.0 one value and
+ *      all NaNs another.
+ *
+ * Arguments:
+ *      - sketch    : The sketch.
+ *      - values    : The array.
+ *      - len       : Number of values.
+ *      - type      : The data type of the array.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments.
+ */
+int sketch_hll_add(Sketch_Hll *sketch, const void *values, int len, Fetch_Type type);
+
+/*
+ * Function: sketch_hll_merge()
+ * ----------------------
+ * Description:
+ *      Adds every value counted by one sketch to another.
+ *
+ * Arguments:
+ *      - dst   : The sketch to merge into.
+ *      - src   : The sketch to merge, of the same precision.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or different precisions.
+ */
+int sketch_hll_merge(Sketch_Hll *dst, const Sketch_Hll *src);
+
+/*
+ * Function: sketch_hll_count()
+ * ----------------------
+ * Description:
+ *      Estimates the number of distinct values added.
+ *
+ * Arguments:
+ *      - sketch    : The sketch.
+ *
+ * Returns:
+ *      The estimate, or -1 on invalid arguments.
+ */
+double sketch_hll_count(const Sketch_Hll *sketch);
+
+#endif // SKETCH_UTILS_H
+
+/* sketch_utils.h */
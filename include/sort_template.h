@@ -0,0 +1,246 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : sort_template.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains a header-only generator of sorting
+ *      functions for any element type, including user structs.
+ */
+
+#ifndef SORT_TEMPLATE_H
+#define SORT_TEMPLATE_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: Unlike qsort(), the comparison is expanded inline and elements
+ * are moved by plain assignment, so there is no indirect call and no
+ * memcpy() per swap. Each SORT_DEFINE() only instantiates static inline
+ * functions, so it may be used in as many source files as needed.
+ */
+
+/* [ Macros ] */
+
+#define SORT_INSERTION_CUTOFF (24)  // ranges at most this long are insertion sorted
+
+/*
+ * SORT_DEFINE()
+ * ----------------------
+ * Description:
+ *      Instantiates the following functions for element type T:
+ *
+ *      void prefix_insertion_sort(T *arr, int len);
+ *      void prefix_heap_sort(T *arr, int len);
+ *      void prefix_sort(T *arr, int len);
+ *      void prefix_merge_sort_buf(T *arr, int len, T *buf);
+ *      int  prefix_merge_sort(T *arr, int len);
+ *
+ *      prefix_sort() is an introsort: quick sort with a median-of-three
+ *      pivot, insertion sort for short ranges, and heap sort once the
+ *      recursion gets too deep, so it is O(n log n) in the worst case.
+ *      prefix_merge_sort() is stable; it allocates a buffer of len
+ *      elements (returning -1 on failure), or the caller can provide one
+ *      through prefix_merge_sort_buf().
+ *
+ * Arguments:
+ *      - prefix  : Name prefix of the generated functions.
+ *      - T       : Element type.
+ *      - LESS    : Function-like macro or function, LESS(a, b) is true
+ *                  when a must be ordered before b. It receives lvalues.
+ *
+ * Example:
+ *      typedef struct { int id; double score; } Record;
+ *      #define RECORD_LESS(a, b) ((a).score < (b).score)
+ *      SORT_DEFINE(record, Record, RECORD_LESS)
+ *
+ *      record_sort(records, count);
+ */
+#define SORT_DEFINE(prefix, T, LESS)                                            \
+                                                                                \
+static inline void prefix##_insertion_sort(T *arr, int len)                     \
+{                                                                               \
+    for (int i = 1; i < len; ++i)                                               \
+    {                                                                           \
+        T key = arr[i];                                                         \
+        int j = i - 1;                                                          \
+                                                                                \
+        while (j >= 0 && LESS(key, arr[j]))                                     \
+        {                                                                       \
+            arr[j + 1] = arr[j];                                                \
+            --j;                                                                \
+        }                                                                       \
+                                                                                \
+        arr[j + 1] = key;                                                       \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static inline void prefix##_sift_down(T *arr, int root, int len)                \
+{                                                                               \
+    T value = arr[root];                                                        \
+                                                                                \
+    for (int child = 2 * root + 1; child < len; child = 2 * root + 1)           \
+    {                                                                           \
+        if (child + 1 < len && LESS(arr[child], arr[child + 1]))                \
+            child++;                                                            \
+                                                                                \
+        if (!LESS(value, arr[child]))                                           \
+            break;                                                              \
+                                                                                \
+        arr[root] = arr[child];                                                 \
+        root = child;                                                           \
+    }                                                                           \
+                                                                                \
+    arr[root] = value;                                                          \
+}                                                                               \
+                                                                                \
+static inline void prefix##_heap_sort(T *arr, int len)                          \
+{                                                                               \
+    for (int i = len / 2 - 1; i >= 0; --i)                                      \
+        prefix##_sift_down(arr, i, len);                                        \
+                                                                                \
+    for (int end = len - 1; end > 0; --end)                                     \
+    {                                                                           \
+        T top = arr[0];                                                         \
+        arr[0] = arr[end];                                                      \
+        arr[end] = top;                                                         \
+        prefix##_sift_down(arr, 0, end);                                        \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static inline void prefix##_introsort(T *arr, int len, int depth)               \
+{                                                                               \
+    while (len > SORT_INSERTION_CUTOFF)                                         \
+    {                                                                           \
+        if (depth-- == 0)                                                       \
+        {                                                                       \
+            prefix##_heap_sort(arr, len);                                       \
+            return;                                                             \
+        }                                                                       \
+                                                                                \
+        /* Median of three moved to the front, the others act as sentinels. */ \
+        int mid = len / 2;                                                      \
+        T tmp;                                                                  \
+                                                                                \
+        if (LESS(arr[mid], arr[0]))       { tmp = arr[mid]; arr[mid] = arr[0]; arr[0] = tmp; }             \
+        if (LESS(arr[len - 1], arr[mid])) { tmp = arr[mid]; arr[mid] = arr[len - 1]; arr[len - 1] = tmp; } \
+        if (LESS(arr[mid], arr[0]))       { tmp = arr[mid]; arr[mid] = arr[0]; arr[0] = tmp; }             \
+                                                                                \
+        T pivot = arr[mid];                                                     \
+        int i = 0, j = len - 1;                                                 \
+                                                                                \
+        /* Hoare partition: equal keys are split evenly between sides. */     \
+        for (;;)                                                                \
+        {                                                                       \
+            while (LESS(arr[i], pivot))                                         \
+                i++;                                                            \
+            while (LESS(pivot, arr[j]))                                         \
+                j--;                                                            \
+                                                                                \
+            if (i >= j)                                                         \
+                break;                                                          \
+                                                                                \
+            tmp = arr[i];                                                       \
+            arr[i++] = arr[j];                                                  \
+            arr[j--] = tmp;                                                     \
+        }                                                                       \
+                                                                                \
+        /* Recurse into the smaller side to bound the stack depth. */           \
+        int left = j + 1;                                                       \
+                                                                                \
+        if (left < len - left)                                                  \
+        {                                                                       \
+            prefix##_introsort(arr, left, depth);                               \
+            arr += left;                                                        \
+            len -= left;                                                        \
+        }                                                                       \
+        else                                                                    \
+        {                                                                       \
+            prefix##_introsort(arr + left, len - left, depth);                  \
+            len = left;                                                         \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    prefix##_insertion_sort(arr, len);                                          \
+}                                                                               \
+                                                                                \
+static inline void prefix##_sort(T *arr, int len)                               \
+{                                                                               \
+    int depth = 0;                                                              \
+                                                                                \
+    for (int n = len; n > 1; n >>= 1)                                           \
+        depth += 2;                                                             \
+                                                                                \
+    prefix##_introsort(arr, len, depth);                                        \
+}                                                                               \
+                                                                                \
+static inline void prefix##_merge_sort_buf(T *arr, int len, T *buf)             \
+{                                                                               \
+    /* Short runs are insertion sorted, then merged bottom-up. */               \
+    for (int i = 0; i < len; i += SORT_INSERTION_CUTOFF)                        \
+    {                                                                           \
+        int run = len - i < SORT_INSERTION_CUTOFF ? len - i : SORT_INSERTION_CUTOFF; \
+        prefix##_insertion_sort(arr + i, run);                                  \
+    }                                                                           \
+                                                                                \
+    T *src = arr, *dst = buf;                                                   \
+                                                                                \
+    for (int width = SORT_INSERTION_CUTOFF; width < len; width *= 2)            \
+    {                                                                           \
+        for (int lo = 0; lo < len; lo += 2 * width)                             \
+        {                                                                       \
+            int mid = lo + width < len ? lo + width : len;                      \
+            int hi = lo + 2 * width < len ? lo + 2 * width : len;               \
+            int i = lo, j = mid, k = lo;                                        \
+                                                                                \
+            /* Taking from the right only when strictly less keeps it stable. */ \
+            while (i < mid && j < hi)                                           \
+                dst[k++] = LESS(src[j], src[i]) ? src[j++] : src[i++];          \
+            while (i < mid)                                                     \
+                dst[k++] = src[i++];                                            \
+            while (j < hi)                                                      \
+                dst[k++] = src[j++];                                            \
+        }                                                                       \
+                                                                                \
+        T *swap = src;                                                          \
+        src = dst;                                                              \
+        dst = swap;                                                             \
+    }                                                                           \
+                                                                                \
+    if (src != arr)                                                             \
+    {                                                                           \
+        for (int i = 0; i < len; ++i)                                           \
+            arr[i] = src[i];                                                    \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static inline int prefix##_merge_sort(T *arr, int len)                          \
+{                                                                               \
+    if (len <= SORT_INSERTION_CUTOFF)                                           \
+    {                                                                           \
+        prefix##_insertion_sort(arr, len);                                      \
+        return 0;                                                               \
+    }                                                                           \
+                                                                                \
+    T *buf = malloc((size_t)len * sizeof(T));                                   \
+    if (buf == NULL)                                                            \
+        return -1;                                                              \
+                                                                                \
+    prefix##_merge_sort_buf(arr, len, buf);                                     \
+    free(buf);                                                                  \
+    return 0;                                                                   \
+}
+
+#endif // SORT_TEMPLATE_H
+
+/* sort_template.h */
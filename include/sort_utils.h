@@ -16,6 +16,7 @@
 
 /* [ Headers ] */
 #include <custom_utils.h>
+#include <context_utils.h>
 
 /* 
  * [WARNING]: Your IDE might not find the file, so you might have to 
@@ -29,6 +30,13 @@
  * will only have a shortened description for code clarity.
  */
 
+/*
+ * [INFO]: Sorts that do not allocate (bubble, insertion and quick sort,
+ * unique() and the set operations) only touch the arrays they are given
+ * and are safe to call from several threads at once. The ones that do
+ * allocate have a _ctx variant taking their memory from a Utils_Context.
+ */
+
 /* [ Functions ] */
 
 /*
@@ -66,6 +74,21 @@ int partition(int arr[], int low, int high);
  */
 void merge(int arr[], int l, int m, int r);
 
+/*
+ * merge_ctx()
+ * ----------------------
+ * Description:
+ *      merge() taking its buffer from the context's allocator.
+ *
+ * Arguments:
+ *      - ctx     : The context to allocate and log through.
+ *      - (others): As for merge().
+ *
+ * Return:
+ *      0 on success, -1 on allocation failure (arr is left untouched).
+ */
+int merge_ctx(Utils_Context *ctx, int arr[], int l, int m, int r);
+
 /*
  * bubble_sort()
  * ----------------------
@@ -133,6 +156,170 @@ void quick_sort(int arr[], int low, int high);
  */
 void merge_sort(int arr[], int l, int r);
 
+/*
+ * merge_sort_ctx()
+ * ----------------------
+ * Description:
+ *      merge_sort() taking a single buffer for the whole sort from the
+ *      context's allocator, instead of two per merge.
+ *
+ * Arguments:
+ *      - ctx     : The context to allocate and log through.
+ *      - (others): As for merge_sort().
+ *
+ * Return:
+ *      0 on success, -1 on allocation failure (arr is left untouched).
+ */
+int merge_sort_ctx(Utils_Context *ctx, int arr[], int l, int r);
+
+/*
+ * Function: unique()
+ * ----------------------
+ * Description:
+ *      Removes consecutive duplicates from a sorted array in place,
+ *      optionally recording how many times each value appeared.
+ *
+ * Arguments:
+ *      - arr[]   : Sorted array to deduplicate.
+ *      - len     : Length of the array.
+ *      - type    : The data type of the array.
+ *      - counts  : Optional array of len counters, filled with the number
+ *                  of occurrences of each kept value (NULL to skip).
+ *
+ * Returns:
+ *      The number of distinct values, or -1 on invalid arguments.
+ */
+int unique(void *arr, int len, Fetch_Type type, int *counts);
+
+/*
+ * Function: merge_arrays()
+ * ----------------------
+ * Description:
+ *      Merges two sorted arrays into a caller-provided buffer.
+ *      Equal elements keep their order, those of a first.
+ *
+ * Arguments:
+ *      - dst     : Buffer of at least a_len + b_len elements.
+ *      - a       : First sorted array.
+ *      - a_len   : Length of the first array.
+ *      - b       : Second sorted array.
+ *      - b_len   : Length of the second array.
+ *      - type    : The data type of the arrays.
+ *
+ * Returns:
+ *      The number of elements written, or -1 on invalid arguments.
+ *
+ * Notes:
+ *      - dst must not overlap a or b.
+ */
+int merge_arrays(void *dst, const void *a, int a_len, const void *b, int b_len, Fetch_Type type);
+
+/*
+ * Function: set_intersection()
+ * ----------------------
+ * Description:
+ *      Writes the elements present in both sorted arrays. Duplicates are
+ *      kept as many times as they appear in both (multiset semantics).
+ *      When one array is much smaller, its elements gallop through the
+ *      larger one; int arrays of similar size are scanned with AVX2.
+ *
+ * Arguments:
+ *      - dst     : Buffer of at least min(a_len, b_len) elements.
+ *      - a       : First sorted array.
+ *      - a_len   : Length of the first array.
+ *      - b       : Second sorted array.
+ *      - b_len   : Length of the second array.
+ *      - type    : The data type of the arrays.
+ *
+ * Returns:
+ *      The number of elements written, or -1 on invalid arguments.
+ */
+int set_intersection(void *dst, const void *a, int a_len, const void *b, int b_len, Fetch_Type type);
+
+/*
+ * Function: set_union()
+ * ----------------------
+ * Description:
+ *      Writes the elements present in either sorted array. A value
+ *      appears as many times as in the array holding more of it.
+ *
+ * Arguments:
+ *      - dst     : Buffer of at least a_len + b_len elements.
+ *      - a       : First sorted array.
+ *      - a_len   : Length of the first array.
+ *      - b       : Second sorted array.
+ *      - b_len   : Length of the second array.
+ *      - type    : The data type of the arrays.
+ *
+ * Returns:
+ *      The number of elements written, or -1 on invalid arguments.
+ */
+int set_union(void *dst, const void *a, int a_len, const void *b, int b_len, Fetch_Type type);
+
+/*
+ * Function: set_difference()
+ * ----------------------
+ * Description:
+ *      Writes the elements of a that are not in b. Every element of b
+ *      cancels at most one equal element of a.
+ *
+ * Arguments:
+ *      - dst     : Buffer of at least a_len elements.
+ *      - a       : Sorted array to subtract from.
+ *      - a_len   : Length of the first array.
+ *      - b       : Sorted array of elements to remove.
+ *      - b_len   : Length of the second array.
+ *      - type    : The data type of the arrays.
+ *
+ * Returns:
+ *      The number of elements written, or -1 on invalid arguments.
+ */
+int set_difference(void *dst, const void *a, int a_len, const void *b, int b_len, Fetch_Type type);
+
+/*
+ * Function: range_sort()
+ * ----------------------
+ * Description:
+ *      Sorts an array whose values are known to lie in [min, max], the
+ *      same bounds passed to fetch_array(). Integer arrays whose range is
+ *      small next to their length are counting sorted in O(n + range);
+ *      wider integer ranges are radix sorted with only as many passes as
+ *      the range needs. Floating-point arrays are bucket sorted over the
+ *      range, falling back to radix sort when the data is skewed.
+ *
+ * Arguments:
+ *      - arr[]   : Array to sort.
+ *      - len     : Length of the array.
+ *      - type    : The data type of the array.
+ *      - min     : Smallest value the array may hold.
+ *      - max     : Largest value the array may hold.
+ *
+ * Returns:
+ *      0 on success, -1 if a value lies outside [min, max], on invalid
+ *      arguments or on allocation failure. The array is left untouched
+ *      when a value is out of range.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int range_sort(void *arr, int len, Fetch_Type type, double min, double max);
+
+/*
+ * Function: range_sort_ctx()
+ * ----------------------
+ * Description:
+ *      range_sort() allocating its buffers and logging errors
+ *      through the context.
+ *
+ * Arguments:
+ *      - ctx     : The context to allocate and log through.
+ *      - (others): As for range_sort().
+ *
+ * Returns:
+ *      As for range_sort().
+ */
+int range_sort_ctx(Utils_Context *ctx, void *arr, int len, Fetch_Type type, double min, double max);
+
 #endif // SORT_UTILS_H
 
 /* sort_utils.h */
\ No newline at end of file
@@ -0,0 +1,254 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : sorted_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      sorted_utils.c specifically.
+ */
+
+#ifndef SORTED_UTILS_H
+#define SORTED_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: A Sorted_Array keeps a multiset of values sorted while values
+ * stream in and out, in the style of a log-structured merge tree. New
+ * values land in a small unsorted tail; a full tail is sorted and merged
+ * into a run, and a run grown past about sqrt(SORTED_TAIL * count)
+ * values is merged into the base array. Removals are buffered the same
+ * way and subtracted at that merge. Each value is therefore copied a few
+ * hundred times at most over its life, where re-sorting the whole array
+ * after every batch costs O(n log n) per batch.
+ *
+ * Queries combine a binary search of the base and of the run with a
+ * scan of the tails, so they stay O(log n + SORTED_TAIL) between merges.
+ */
+
+/* [ Macros ] */
+
+#define SORTED_TAIL (256)       // values buffered unsorted before being merged into the run
+#define SORTED_RUN_MIN (4096)   // smallest run worth merging into the base
+
+/* [ Structs ] */
+
+typedef struct
+{
+    void *base;         // sorted values merged so far
+    void *spare;        // merge target, as large as base
+    int len;            // number of values in base
+    int capacity;       // room in base and spare
+    void *run;          // sorted recent inserts
+    int run_len;        // number of values in run
+    void *tail;         // unsorted newest inserts
+    int tail_len;       // number of values in tail
+    void *dels;         // sorted pending removals
+    int dels_len;       // number of values in dels
+    void *dtail;        // unsorted newest removals
+    int dtail_len;      // number of values in dtail
+    int run_limit;      // run or dels size that triggers a merge into base
+    int count;          // number of values held, after removals
+    Fetch_Type type;    // type of the values
+} Sorted_Array;
+
+/* [ Functions ] */
+
+/*
+ * Function: sorted_init()
+ * ----------------------
+ * Description:
+ *      Creates an empty sorted array.
+ *
+ * Arguments:
+ *      - sorted    : The array to create.
+ *      - type      : The data type of the values.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation, release it with sorted_free().
+ */
+int sorted_init(Sorted_Array *sorted, Fetch_Type type);
+
+/*
+ * Function: sorted_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a sorted array.
+ *
+ * Arguments:
+ *      - sorted    : The array to release.
+ *
+ * Returns: -
+ */
+void sorted_free(Sorted_Array *sorted);
+
+/*
+ * Function: sorted_insert() / sorted_insert_batch()
+ * ----------------------
+ * Description:
+ *      Adds one value, or an array of values in any order. A batch
+ *      larger than the run limit is sorted on its own and merged
+ *      straight into the base.
+ *
+ * Arguments:
+ *      - sorted    : The array to add to.
+ *      - value(s)  : Pointer to the value(s), of the array's type.
+ *      - len       : Number of values.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure, in
+ *      which case the values added before the failure are kept.
+ *
+ * Notes:
+ *      - NaN values cannot be ordered and must not be inserted.
+ */
+int sorted_insert(Sorted_Array *sorted, const void *value);
+int sorted_insert_batch(Sorted_Array *sorted, const void *values, int len);
+
+/*
+ * Function: sorted_remove()
+ * ----------------------
+ * Description:
+ *      Removes one occurrence of a value.
+ *
+ * Arguments:
+ *      - sorted    : The array to remove from.
+ *      - value     : Pointer to the value, of the array's type.
+ *
+ * Returns:
+ *      1 if the value was removed, 0 if it was not in the array, -1 on
+ *      invalid arguments or allocation failure.
+ */
+int sorted_remove(Sorted_Array *sorted, const void *value);
+
+/*
+ * Function: sorted_rank()
+ * ----------------------
+ * Description:
+ *      Counts the values less than a key, which is also the index the
+ *      key would have in the fully sorted array.
+ *
+ * Arguments:
+ *      - sorted    : The array.
+ *      - key       : Pointer to the key, of the array's type.
+ *
+ * Returns:
+ *      The number of values less than the key, or -1 on invalid arguments.
+ */
+int sorted_rank(const Sorted_Array *sorted, const void *key);
+
+/*
+ * Function: sorted_count_range()
+ * ----------------------
+ * Description:
+ *      Counts the values in [lo, hi].
+ *
+ * Arguments:
+ *      - sorted    : The array.
+ *      - lo        : Pointer to the lower bound, of the array's type.
+ *      - hi        : Pointer to the upper bound, of the array's type.
+ *
+ * Returns:
+ *      The number of values, 0 if lo > hi, or -1 on invalid arguments.
+ */
+int sorted_count_range(const Sorted_Array *sorted, const void *lo, const void *hi);
+
+/*
+ * Function: sorted_lower_bound()
+ * ----------------------
+ * Description:
+ *      Finds the smallest value not less than a key.
+ *
+ * Arguments:
+ *      - sorted    : The array.
+ *      - key       : Pointer to the key, of the array's type.
+ *      - out       : Receives the value found.
+ *
+ * Returns:
+ *      1 if a value was found, 0 if every value is less than the key,
+ *      or -1 on invalid arguments.
+ */
+int sorted_lower_bound(const Sorted_Array *sorted, const void *key, void *out);
+
+/*
+ * Function: sorted_select()
+ * ----------------------
+ * Description:
+ *      Finds the value at an index of the fully sorted array (the k-th
+ *      smallest), by a binary search over the base and the run.
+ *
+ * Arguments:
+ *      - sorted    : The array.
+ *      - k         : Index of the value, from 0 to sorted->count - 1.
+ *      - out       : Receives the value.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Notes:
+ *      - The insert tail is merged into the run first, and pending
+ *      removals into the base, so calls right after removals cost O(n).
+ */
+int sorted_select(Sorted_Array *sorted, int k, void *out);
+
+/*
+ * Function: sorted_range()
+ * ----------------------
+ * Description:
+ *      Copies the values in [lo, hi] out in ascending order, merging
+ *      the matching slices of the base and the run.
+ *
+ * Arguments:
+ *      - sorted    : The array.
+ *      - lo        : Pointer to the lower bound, of the array's type.
+ *      - hi        : Pointer to the upper bound, of the array's type.
+ *      - out       : Buffer of sorted_count_range() values.
+ *
+ * Returns:
+ *      The number of values written, or -1 on invalid arguments or
+ *      allocation failure.
+ *
+ * Notes:
+ *      - Pending changes are merged first, as for sorted_select().
+ */
+int sorted_range(Sorted_Array *sorted, const void *lo, const void *hi, void *out);
+
+/*
+ * Function: sorted_flush()
+ * ----------------------
+ * Description:
+ *      Merges every pending insert and removal into the base, after
+ *      which sorted->base holds all sorted->count values in order and
+ *      can be read directly.
+ *
+ * Arguments:
+ *      - sorted    : The array.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ */
+int sorted_flush(Sorted_Array *sorted);
+
+#endif // SORTED_UTILS_H
+
+/* sorted_utils.h */
@@ -0,0 +1,235 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : stats_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      stats_utils.c specifically.
+ */
+
+#ifndef STATS_UTILS_H
+#define STATS_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/*
+ * [INFO]: Every value is widened to double before it is accumulated,
+ * so results for long and long long arrays lose precision past 2^53.
+ * NaN values are not filtered out.
+ */
+
+/* [ Structs ] */
+
+typedef struct
+{
+    int count;          // number of values described
+    double min;         // smallest value
+    double max;         // largest value
+    double sum;         // compensated sum of all values
+    double mean;        // arithmetic mean
+    double variance;    // population variance
+    double stddev;      // population standard deviation
+} Stats_Summary;
+
+/* [ Enums ] */
+
+typedef enum
+{
+    STATS_MIN,          // smallest value
+    STATS_MAX,          // largest value
+    STATS_SUM,          // sum of values
+    STATS_MEAN,         // arithmetic mean
+    STATS_VARIANCE,     // population variance
+} Stats_Op;
+
+/* [ Functions ] */
+
+/*
+ * Function: stats_describe()
+ * ----------------------
+ * Description:
+ *      Computes the minimum, maximum, sum, mean and variance of an array
+ *      in a single pass over memory. The array is walked in small blocks
+ *      that stay in L1; each block is reduced with the fastest kernel the
+ *      CPU supports, and the blocks are combined with compensated summation
+ *      and Chan's pairwise variance update.
+ *
+ * Arguments:
+ *      - arr       : The array to describe.
+ *      - len       : Number of elements in the array.
+ *      - type      : The data type of the array.
+ *      - summary   : Where the results are stored.
+ *
+ * Returns:
+ *      0 on success, -1 if the array is empty or the type is unsupported.
+ */
+int stats_describe(const void *arr, int len, Fetch_Type type, Stats_Summary *summary);
+
+/*
+ * Function: stats_min()
+ * ----------------------
+ * Description:
+ *      Returns the smallest value of an array.
+ *
+ * Arguments:
+ *      - arr   : The array to reduce.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *
+ * Returns:
+ *      The smallest value, or NAN if the array is empty.
+ */
+double stats_min(const void *arr, int len, Fetch_Type type);
+
+/*
+ * Function: stats_max()
+ * ----------------------
+ * Description:
+ *      Returns the largest value of an array.
+ *
+ * Arguments:
+ *      - arr   : The array to reduce.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *
+ * Returns:
+ *      The largest value, or NAN if the array is empty.
+ */
+double stats_max(const void *arr, int len, Fetch_Type type);
+
+/*
+ * Function: stats_sum()
+ * ----------------------
+ * Description:
+ *      Returns the sum of an array, using pairwise accumulation inside
+ *      each block and compensated summation across blocks.
+ *
+ * Arguments:
+ *      - arr   : The array to reduce.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *
+ * Returns:
+ *      The sum, or 0 if the array is empty.
+ */
+double stats_sum(const void *arr, int len, Fetch_Type type);
+
+/*
+ * Function: stats_mean()
+ * ----------------------
+ * Description:
+ *      Returns the arithmetic mean of an array.
+ *
+ * Arguments:
+ *      - arr   : The array to reduce.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *
+ * Returns:
+ *      The mean, or NAN if the array is empty.
+ */
+double stats_mean(const void *arr, int len, Fetch_Type type);
+
+/*
+ * Function: stats_variance()
+ * ----------------------
+ * Description:
+ *      Returns the population variance of an array.
+ *
+ * Arguments:
+ *      - arr   : The array to reduce.
+ *      - len   : Number of elements in the array.
+ *      - type  : The data type of the array.
+ *
+ * Returns:
+ *      The variance, or NAN if the array is empty.
+ */
+double stats_variance(const void *arr, int len, Fetch_Type type);
+
+/*
+ * Function: stats_histogram()
+ * ----------------------
+ * Description:
+ *      Counts the values of an array into equal-width bins spanning
+ *      [min, max]. Values equal to max land in the last bin, values
+ *      outside the range and NaNs are skipped. min and max must be
+ *      finite.
+ *
+ * Arguments:
+ *      - arr       : The array to count.
+ *      - len       : Number of elements in the array.
+ *      - type      : The data type of the array.
+ *      - min       : Lower edge of the first bin.
+ *      - max       : Upper edge of the last bin.
+ *      - bins      : Caller-provided array of bin_cnt counters (zeroed here).
+ *      - bin_cnt   : Number of bins.
+ *
+ * Returns:
+ *      The number of values counted, or -1 on invalid arguments.
+ */
+int stats_histogram(const void *arr, int len, Fetch_Type type, double min, double max, int *bins, int bin_cnt);
+
+/*
+ * Function: stats_reduce_rows()
+ * ----------------------
+ * Description:
+ *      Applies a reduction to every row of a matrix, such as one
+ *      returned by fetch_matrix().
+ *
+ * Arguments:
+ *      - matrix    : The matrix to reduce.
+ *      - rows      : Number of rows.
+ *      - cols      : Number of columns.
+ *      - type      : The data type of the matrix.
+ *      - op        : The reduction to apply.
+ *      - out       : Caller-provided array of rows results.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments.
+ */
+int stats_reduce_rows(void **matrix, int rows, int cols, Fetch_Type type, Stats_Op op, double *out);
+
+/*
+ * Function: stats_reduce_cols()
+ * ----------------------
+ * Description:
+ *      Applies a reduction to every column of a matrix, such as one
+ *      returned by fetch_matrix(). Rows are streamed one at a time
+ *      into per-column accumulators, so memory is read sequentially.
+ *
+ * Arguments:
+ *      - matrix    : The matrix to reduce.
+ *      - rows      : Number of rows.
+ *      - cols      : Number of columns.
+ *      - type      : The data type of the matrix.
+ *      - op        : The reduction to apply.
+ *      - out       : Caller-provided array of cols results.
+ *
+ * Returns:
+ *      0 on success, -1 on invalid arguments or allocation failure.
+ *
+ * Warning:
+ *      Uses memory allocation.
+ */
+int stats_reduce_cols(void **matrix, int rows, int cols, Fetch_Type type, Stats_Op op, double *out);
+
+#endif // STATS_UTILS_H
+
+/* stats_utils.h */
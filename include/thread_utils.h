@@ -0,0 +1,58 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : thread_utils.h
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description  :
+ *      This file contains all of the declarations for
+ *      thread_utils.c specifically.
+ */
+
+#ifndef THREAD_UTILS_H
+#define THREAD_UTILS_H
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <pthread.h>
+
+/*
+ * [WARNING]: Your IDE might not find the file, so you might have to
+ * include that within your settings.json (if on Visual Studio Code)
+ * or alter the include path to match the location of custom_utils.h
+ */
+
+/*
+ * [INFO]: The full description of each function will be present
+ * within the header only - the function definitions in the source files
+ * will only have a shortened description for code clarity.
+ */
+
+/* [ Functions ] */
+
+/*
+ * Function: thread_fork_join()
+ * ----------------------
+ * Description:
+ *      Runs fn on count equally sized items in parallel: items 1 to
+ *      count - 1 each get a thread, started before the calling thread
+ *      runs item 0, and all of them are joined before returning. If a
+ *      thread cannot be created, that item and the ones after it run
+ *      on the calling thread once item 0 is done.
+ *
+ * Arguments:
+ *      - fn        : The function to run, a pthread entry point.
+ *      - items     : The first item, passed to fn by address.
+ *      - stride    : Size of one item in bytes.
+ *      - count     : Number of items.
+ *      - tid       : Caller-provided array of count thread ids.
+ *
+ * Returns: -
+ */
+void thread_fork_join(void *(*fn)(void *), void *items, size_t stride, int count, pthread_t *tid);
+
+#endif // THREAD_UTILS_H
+
+/* thread_utils.h */
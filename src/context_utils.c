@@ -0,0 +1,428 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : context_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at managing per-thread library contexts.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <context_utils.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* [ Default Allocator ] */
+
+static void *context_std_alloc(void *user, size_t size)
+{
+    (void)user;
+    return malloc(size);
+}
+
+static void *context_std_realloc(void *user, void *ptr, size_t size)
+{
+    (void)user;
+    return realloc(ptr, size);
+}
+
+static void context_std_free(void *user, void *ptr)
+{
+    (void)user;
+    free(ptr);
+}
+
+/* [ Arena ] */
+
+/* A block of an arena, followed by its memory. */
+struct Utils_Arena_Block
+{
+    struct Utils_Arena_Block *prev;     // older block
+    size_t size;                        // bytes of memory after the header
+    size_t used;                        // bytes carved so far
+    max_align_t data[];                 // the memory
+};
+
+/* Every allocation is preceded by its size, so it can be resized. */
+#define CONTEXT_ARENA_ALIGN (sizeof(max_align_t))
+
+static void *context_arena_std_alloc(void *user, size_t size)
+{
+    return context_arena_alloc(user, size);
+}
+
+static void *context_arena_std_realloc(void *user, void *ptr, size_t size)
+{
+    Utils_Arena *arena = user;
+
+    if (ptr == NULL)
+        return context_arena_alloc(arena, size);
+
+    size_t *header = (size_t *)((char *)ptr - CONTEXT_ARENA_ALIGN);
+    size_t old = *header;
+    struct Utils_Arena_Block *block = arena->head;
+
+    /* The latest allocation of the current block grows in place. */
+    if ((char *)ptr + old == (char *)block->data + block->used)
+    {
+        size_t grown = (size + CONTEXT_ARENA_ALIGN - 1) / CONTEXT_ARENA_ALIGN * CONTEXT_ARENA_ALIGN;
+
+        if (grown >= size && (char *)ptr + grown <= (char *)block->data + block->size)
+        {
+            block->used = (size_t)((char *)ptr + grown - (char *)block->data);
+            arena->used += grown - old;
+            *header = grown;
+            return ptr;
+        }
+    }
+
+    void *moved = context_arena_alloc(arena, size);
+    if (moved != NULL)
+        memcpy(moved, ptr, old < size ? old : size);
+
+    return moved;
+}
+
+static void context_arena_std_free(void *user, void *ptr)
+{
+    (void)user;
+    (void)ptr;
+}
+
+/* [ Functions ] */
+
+/*
+ * context_init()
+ * ----------------------
+ * Description:
+ *      Initializes a context with the given streams.
+ */
+void context_init(Utils_Context *ctx, FILE *in, FILE *out, FILE *err)
+{
+    ctx->in = in;
+    ctx->out = out;
+    ctx->err = err;
+    ctx->stream = NULL;
+    ctx->timeout = -1;
+    ctx->retry = true;
+    ctx->color = true;
+    ctx->print.max_elements = 0;
+    ctx->print.max_rows = 0;
+    ctx->print.align = false;
+    ctx->print.float_precision = 2;
+    ctx->print.double_precision = 4;
+    ctx->interactive = in != NULL && isatty(fileno(in));
+
+    ctx->allocator.alloc = context_std_alloc;
+    ctx->allocator.realloc = context_std_realloc;
+    ctx->allocator.free = context_std_free;
+    ctx->allocator.user = NULL;
+
+    ctx->buf = NULL;
+    ctx->len = 0;
+    ctx->cap = 0;
+    ctx->growable = true;
+    ctx->target = out;
+}
+
+/*
+ * context_destroy()
+ * ----------------------
+ * Description:
+ *      Releases the record buffer of a context.
+ */
+void context_destroy(Utils_Context *ctx)
+{
+    if (ctx->growable)
+        context_release(ctx, ctx->buf);
+
+    ctx->buf = NULL;
+    ctx->len = 0;
+    ctx->cap = 0;
+}
+
+/*
+ * context_default()
+ * ----------------------
+ * Description:
+ *      Returns the calling thread's default context.
+ */
+Utils_Context *context_default(void)
+{
+    static _Thread_local Utils_Context ctx;
+    static _Thread_local char buf[CONTEXT_DEFAULT_BUFFER];
+    static _Thread_local bool ready = false;
+
+    if (!ready)
+    {
+        context_init(&ctx, stdin, stdout, stderr);
+
+        /* A fixed buffer, so threads that exit leak nothing. */
+        ctx.buf = buf;
+        ctx.cap = sizeof(buf);
+        ctx.growable = false;
+        ready = true;
+    }
+
+    return &ctx;
+}
+
+/*
+ * context_flush()
+ * ----------------------
+ * Description:
+ *      Writes out whatever the record buffer holds.
+ */
+static void context_flush(Utils_Context *ctx)
+{
+    if (ctx->len > 0 && ctx->target != NULL)
+        fwrite(ctx->buf, 1, ctx->len, ctx->target);
+
+    ctx->len = 0;
+}
+
+/*
+ * context_reserve()
+ * ----------------------
+ * Description:
+ *      Makes room for len more bytes plus a terminator, growing the
+ *      buffer or flushing a fixed one. Returns false if there is still
+ *      not enough room.
+ */
+static bool context_reserve(Utils_Context *ctx, size_t len)
+{
+    if (ctx->len + len < ctx->cap)
+        return true;
+
+    if (ctx->growable)
+    {
+        size_t cap = ctx->cap ? ctx->cap : BUFFER;
+
+        while (cap <= ctx->len + len)
+            cap *= 2;
+
+        char *buf = context_realloc(ctx, ctx->buf, cap);
+        if (buf != NULL)
+        {
+            ctx->buf = buf;
+            ctx->cap = cap;
+            return true;
+        }
+    }
+
+    context_flush(ctx);
+    return len < ctx->cap;
+}
+
+/*
+ * context_begin()
+ * ----------------------
+ * Description:
+ *      Starts a new record.
+ */
+void context_begin(Utils_Context *ctx, FILE *stream)
+{
+    ctx->len = 0;
+    ctx->target = stream;
+}
+
+/*
+ * context_vappend()
+ * ----------------------
+ * Description:
+ *      Appends formatted text to the current record.
+ */
+void context_vappend(Utils_Context *ctx, const char *format, va_list args)
+{
+    va_list copy;
+    size_t room = ctx->cap - ctx->len;
+
+    va_copy(copy, args);
+    int need = vsnprintf(ctx->buf ? ctx->buf + ctx->len : NULL, room, format, copy);
+    va_end(copy);
+
+    if (need < 0)
+        return;
+
+    if ((size_t)need >= room)
+    {
+        /* Too long even for an empty fixed buffer: bypass it. */
+        if (!context_reserve(ctx, (size_t)need))
+        {
+            if (ctx->target != NULL)
+                vfprintf(ctx->target, format, args);
+            return;
+        }
+
+        vsnprintf(ctx->buf + ctx->len, ctx->cap - ctx->len, format, args);
+    }
+
+    ctx->len += (size_t)need;
+}
+
+/*
+ * context_append()
+ * ----------------------
+ * Description:
+ *      Appends formatted text to the current record.
+ */
+void context_append(Utils_Context *ctx, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    context_vappend(ctx, format, args);
+    va_end(args);
+}
+
+/*
+ * context_write()
+ * ----------------------
+ * Description:
+ *      Appends raw bytes to the current record.
+ */
+void context_write(Utils_Context *ctx, const char *data, size_t len)
+{
+    if (!context_reserve(ctx, len))
+    {
+        if (ctx->target != NULL)
+            fwrite(data, 1, len, ctx->target);
+        return;
+    }
+
+    memcpy(ctx->buf + ctx->len, data, len);
+    ctx->len += len;
+}
+
+/*
+ * context_end()
+ * ----------------------
+ * Description:
+ *      Writes the current record with a single fwrite().
+ */
+void context_end(Utils_Context *ctx)
+{
+    context_flush(ctx);
+}
+
+/*
+ * context_arena_init()
+ * ----------------------
+ * Description:
+ *      Initializes an empty arena.
+ */
+void context_arena_init(Utils_Arena *arena, size_t block_size)
+{
+    arena->head = NULL;
+    arena->block_size = block_size > 0 ? block_size : CONTEXT_ARENA_BLOCK;
+    arena->used = 0;
+}
+
+/*
+ * context_arena_alloc()
+ * ----------------------
+ * Description:
+ *      Carves aligned memory out of the current block, starting a new
+ *      one when it is full.
+ */
+void *context_arena_alloc(Utils_Arena *arena, size_t size)
+{
+    size_t need = (size + CONTEXT_ARENA_ALIGN - 1) / CONTEXT_ARENA_ALIGN * CONTEXT_ARENA_ALIGN;
+
+    if (need < size || need > SIZE_MAX - CONTEXT_ARENA_ALIGN - sizeof(struct Utils_Arena_Block))
+        return NULL;
+
+    need += CONTEXT_ARENA_ALIGN;
+
+    struct Utils_Arena_Block *block = arena->head;
+
+    if (block == NULL || block->size - block->used < need)
+    {
+        size_t bytes = need > arena->block_size ? need : arena->block_size;
+
+        block = malloc(sizeof(*block) + bytes);
+        if (block == NULL)
+            return NULL;
+
+        block->prev = arena->head;
+        block->size = bytes;
+        block->used = 0;
+        arena->head = block;
+    }
+
+    char *ptr = (char *)block->data + block->used + CONTEXT_ARENA_ALIGN;
+
+    *(size_t *)(ptr - CONTEXT_ARENA_ALIGN) = need - CONTEXT_ARENA_ALIGN;
+    block->used += need;
+    arena->used += need;
+    return ptr;
+}
+
+/*
+ * context_arena_reset()
+ * ----------------------
+ * Description:
+ *      Releases every allocation, keeping the newest block.
+ */
+void context_arena_reset(Utils_Arena *arena)
+{
+    struct Utils_Arena_Block *block = arena->head;
+
+    if (block == NULL)
+        return;
+
+    while (block->prev != NULL)
+    {
+        struct Utils_Arena_Block *prev = block->prev->prev;
+
+        free(block->prev);
+        block->prev = prev;
+    }
+
+    block->used = 0;
+    arena->used = 0;
+}
+
+/*
+ * context_arena_destroy()
+ * ----------------------
+ * Description:
+ *      Frees every block of the arena.
+ */
+void context_arena_destroy(Utils_Arena *arena)
+{
+    while (arena->head != NULL)
+    {
+        struct Utils_Arena_Block *prev = arena->head->prev;
+
+        free(arena->head);
+        arena->head = prev;
+    }
+
+    arena->used = 0;
+}
+
+/*
+ * context_arena_allocator()
+ * ----------------------
+ * Description:
+ *      Returns an allocator drawing from the arena.
+ */
+Utils_Allocator context_arena_allocator(Utils_Arena *arena)
+{
+    Utils_Allocator allocator = {
+        .alloc = context_arena_std_alloc,
+        .realloc = context_arena_std_realloc,
+        .free = context_arena_std_free,
+        .user = arena,
+    };
+
+    return allocator;
+}
+
+/* context_utils.c */
@@ -0,0 +1,310 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : convert_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at converting arrays between types.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <convert_utils.h>
+#include <cpu_utils.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+
+#ifdef UTILS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/* [ Enums ] */
+
+/* Types are grouped by representation, so long maps to I32 or I64 per platform. */
+typedef enum
+{
+    CONVERT_I32,
+    CONVERT_I64,
+    CONVERT_F32,
+    CONVERT_F64,
+} Convert_Kind;
+
+typedef int (*Convert_Kernel)(void *dst, const void *src, int len, Convert_Mode mode);
+
+/* [ Range Checks ] */
+
+/* Integer to integer: both sides fit in long long. */
+#define CONVERT_INT_FITS(x, lo, hi)     ((long long)(x) >= (long long)(lo) && (long long)(x) <= (long long)(hi))
+#define CONVERT_INT_SAT(x, lo, hi, D)   ((long long)(x) < (long long)(lo) ? (D)(lo) : (long long)(x) > (long long)(hi) ? (D)(hi) : (D)(x))
+
+/* Floating to integer: truncation must land in [lo, -lo), NaN never fits. */
+#define CONVERT_FLT_FITS(x, lo, hi)     (((double)(x) >= (double)(lo) || (double)(x) > (double)(lo) - 1.0) && (double)(x) < -(double)(lo))
+#define CONVERT_FLT_SAT(x, lo, hi, D)   ((x) != (x) ? (D)0 : CONVERT_FLT_FITS(x, lo, hi) ? (D)(x) : (x) < 0 ? (D)(lo) : (D)(hi))
+
+/* Double to float: only finite values past FLT_MAX are out of range. */
+#define CONVERT_NARROW_FITS(x, lo, hi)  (!((x) < (lo) || (x) > (hi)) || isinf(x))
+#define CONVERT_NARROW_SAT(x, lo, hi, D) (isinf(x) ? (D)(x) : (x) < (lo) ? (D)(lo) : (x) > (hi) ? (D)(hi) : (D)(x))
+
+/* Every value of the source fits in the destination. */
+#define CONVERT_ANY_FITS(x, lo, hi)     ((void)(x), true)
+#define CONVERT_ANY_SAT(x, lo, hi, D)   ((D)(x))
+
+/* [ Kernels ] */
+
+/*
+ * CONVERT_KERNEL()
+ * ----------------------
+ * Description:
+ *      Generates the conversion loop for one source/destination pair.
+ *      The mode is switched on once, outside the loops.
+ */
+#define CONVERT_KERNEL(name, S, D, LO, HI, FITS, SAT)                           \
+static int name(void *dst, const void *src, int len, Convert_Mode mode)         \
+{                                                                               \
+    D *d = dst;                                                                 \
+    const S *s = src;                                                           \
+                                                                                \
+    switch (mode)                                                               \
+    {                                                                           \
+        case CONVERT_SATURATE:                                                  \
+            for (int i = 0; i < len; ++i)                                       \
+                d[i] = SAT(s[i], LO, HI, D);                                    \
+            return len;                                                         \
+                                                                                \
+        case CONVERT_CHECKED:                                                   \
+            for (int i = 0; i < len; ++i)                                       \
+            {                                                                   \
+                if (!FITS(s[i], LO, HI))                                        \
+                    return i;                                                   \
+                d[i] = (D)s[i];                                                 \
+            }                                                                   \
+            return len;                                                         \
+                                                                                \
+        default:                                                                \
+            for (int i = 0; i < len; ++i)                                       \
+                d[i] = (D)s[i];                                                 \
+            return len;                                                         \
+    }                                                                           \
+}
+
+#define CONVERT_TO_INT(suffix, S, CHECK) \
+    CONVERT_KERNEL(convert_##suffix##_to_int, S, int, INT_MIN, INT_MAX, CONVERT_##CHECK##_FITS, CONVERT_##CHECK##_SAT)
+#define CONVERT_TO_LONG(suffix, S, CHECK) \
+    CONVERT_KERNEL(convert_##suffix##_to_long, S, long, LONG_MIN, LONG_MAX, CONVERT_##CHECK##_FITS, CONVERT_##CHECK##_SAT)
+#define CONVERT_TO_LONG_LONG(suffix, S, CHECK) \
+    CONVERT_KERNEL(convert_##suffix##_to_long_long, S, long long, LLONG_MIN, LLONG_MAX, CONVERT_##CHECK##_FITS, CONVERT_##CHECK##_SAT)
+#define CONVERT_TO_FLOAT(suffix, S, CHECK) \
+    CONVERT_KERNEL(convert_##suffix##_to_float, S, float, -FLT_MAX, FLT_MAX, CONVERT_##CHECK##_FITS, CONVERT_##CHECK##_SAT)
+#define CONVERT_TO_DOUBLE(suffix, S, CHECK) \
+    CONVERT_KERNEL(convert_##suffix##_to_double, S, double, -DBL_MAX, DBL_MAX, CONVERT_##CHECK##_FITS, CONVERT_##CHECK##_SAT)
+
+CONVERT_TO_INT(int, int, ANY)
+CONVERT_TO_INT(long, long, INT)
+CONVERT_TO_INT(long_long, long long, INT)
+CONVERT_TO_INT(float, float, FLT)
+CONVERT_TO_INT(double, double, FLT)
+
+CONVERT_TO_LONG(int, int, ANY)
+CONVERT_TO_LONG(long, long, ANY)
+CONVERT_TO_LONG(long_long, long long, INT)
+CONVERT_TO_LONG(float, float, FLT)
+CONVERT_TO_LONG(double, double, FLT)
+
+CONVERT_TO_LONG_LONG(int, int, ANY)
+CONVERT_TO_LONG_LONG(long, long, ANY)
+CONVERT_TO_LONG_LONG(long_long, long long, ANY)
+CONVERT_TO_LONG_LONG(float, float, FLT)
+CONVERT_TO_LONG_LONG(double, double, FLT)
+
+CONVERT_TO_FLOAT(int, int, ANY)
+CONVERT_TO_FLOAT(long, long, ANY)
+CONVERT_TO_FLOAT(long_long, long long, ANY)
+CONVERT_TO_FLOAT(float, float, ANY)
+CONVERT_TO_FLOAT(double, double, NARROW)
+
+CONVERT_TO_DOUBLE(int, int, ANY)
+CONVERT_TO_DOUBLE(long, long, ANY)
+CONVERT_TO_DOUBLE(long_long, long long, ANY)
+CONVERT_TO_DOUBLE(float, float, ANY)
+CONVERT_TO_DOUBLE(double, double, ANY)
+
+/* Indexed by [source][destination]. */
+static const Convert_Kernel convert_kernels[TYPE_DOUBLE + 1][TYPE_DOUBLE + 1] = {
+#define CONVERT_ROW(suffix) {                                \
+        [TYPE_INT] = convert_##suffix##_to_int,             \
+        [TYPE_LONG] = convert_##suffix##_to_long,           \
+        [TYPE_LONG_LONG] = convert_##suffix##_to_long_long, \
+        [TYPE_FLOAT] = convert_##suffix##_to_float,         \
+        [TYPE_DOUBLE] = convert_##suffix##_to_double,       \
+    }
+    [TYPE_INT] = CONVERT_ROW(int),
+    [TYPE_LONG] = CONVERT_ROW(long),
+    [TYPE_LONG_LONG] = CONVERT_ROW(long_long),
+    [TYPE_FLOAT] = CONVERT_ROW(float),
+    [TYPE_DOUBLE] = CONVERT_ROW(double),
+#undef CONVERT_ROW
+};
+
+/*
+ * convert_kind()
+ * ----------------------
+ * Description:
+ *      Maps a type to its representation.
+ */
+static Convert_Kind convert_kind(Fetch_Type type)
+{
+    switch (type)
+    {
+        case TYPE_INT:          return CONVERT_I32;
+        case TYPE_LONG:         return sizeof(long) == sizeof(long long) ? CONVERT_I64 : CONVERT_I32;
+        case TYPE_LONG_LONG:    return CONVERT_I64;
+        case TYPE_FLOAT:        return CONVERT_F32;
+        default:                return CONVERT_F64;
+    }
+}
+
+#ifdef UTILS_X86_SIMD
+/*
+ * convert_avx2()
+ * ----------------------
+ * Description:
+ *      Converts the vector-sized body of the array for the pairs that have
+ *      a packed instruction, returning how many elements were handled; the
+ *      scalar kernel finishes the rest. A checked narrowing stops at the
+ *      first vector holding a value out of range, and the scalar kernel
+ *      then pinpoints it.
+ */
+__attribute__((target("avx2")))
+static int convert_avx2(void *dst, Convert_Kind dk, const void *src, Convert_Kind sk, int len, Convert_Mode mode)
+{
+    const char *s = src;
+    char *d = dst;
+    int i = 0;
+
+    if (sk == CONVERT_I32 && dk == CONVERT_F64)
+    {
+        for (; i + 4 <= len; i += 4)
+            _mm256_storeu_pd((double *)d + i, _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)((const int *)s + i))));
+    }
+    else if (sk == CONVERT_I32 && dk == CONVERT_F32)
+    {
+        for (; i + 8 <= len; i += 8)
+            _mm256_storeu_ps((float *)d + i, _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)((const int *)s + i))));
+    }
+    else if (sk == CONVERT_I32 && dk == CONVERT_I64)
+    {
+        for (; i + 4 <= len; i += 4)
+            _mm256_storeu_si256((__m256i *)((long long *)d + i), _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)((const int *)s + i))));
+    }
+    else if (sk == CONVERT_F32 && dk == CONVERT_F64)
+    {
+        for (; i + 4 <= len; i += 4)
+            _mm256_storeu_pd((double *)d + i, _mm256_cvtps_pd(_mm_loadu_ps((const float *)s + i)));
+    }
+    else if (sk == CONVERT_F64 && dk == CONVERT_F32 && mode != CONVERT_SATURATE)
+    {
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        const __m256d max = _mm256_set1_pd(FLT_MAX);
+        const __m256d inf = _mm256_set1_pd(INFINITY);
+
+        for (; i + 4 <= len; i += 4)
+        {
+            __m256d x = _mm256_loadu_pd((const double *)s + i);
+
+            if (mode == CONVERT_CHECKED)
+            {
+                /* Out of range means finite and larger than FLT_MAX in magnitude. */
+                __m256d ax = _mm256_andnot_pd(sign, x);
+                __m256d bad = _mm256_and_pd(_mm256_cmp_pd(ax, max, _CMP_GT_OQ), _mm256_cmp_pd(ax, inf, _CMP_NEQ_OQ));
+
+                if (_mm256_movemask_pd(bad))
+                    break;
+            }
+
+            _mm_storeu_ps((float *)d + i, _mm256_cvtpd_ps(x));
+        }
+    }
+    else if (sk == CONVERT_I64 && dk == CONVERT_I32)
+    {
+        const __m256i lo = _mm256_set1_epi64x(INT_MIN);
+        const __m256i hi = _mm256_set1_epi64x(INT_MAX);
+        const __m256i pack = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+        for (; i + 4 <= len; i += 4)
+        {
+            __m256i x = _mm256_loadu_si256((const __m256i *)((const long long *)s + i));
+            __m256i over = _mm256_cmpgt_epi64(x, hi);
+            __m256i under = _mm256_cmpgt_epi64(lo, x);
+
+            if (mode == CONVERT_CHECKED && !_mm256_testz_si256(_mm256_or_si256(over, under), _mm256_or_si256(over, under)))
+                break;
+
+            if (mode == CONVERT_SATURATE)
+                x = _mm256_blendv_epi8(_mm256_blendv_epi8(x, hi, over), lo, under);
+
+            /* Keep the low half of every lane, as a cast would. */
+            _mm_storeu_si128((__m128i *)((int *)d + i), _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(x, pack)));
+        }
+    }
+    else if (sk == CONVERT_F32 && dk == CONVERT_I32 && mode == CONVERT_CAST)
+    {
+        for (; i + 8 <= len; i += 8)
+            _mm256_storeu_si256((__m256i *)((int *)d + i), _mm256_cvttps_epi32(_mm256_loadu_ps((const float *)s + i)));
+    }
+    else if (sk == CONVERT_F64 && dk == CONVERT_I32 && mode == CONVERT_CAST)
+    {
+        for (; i + 4 <= len; i += 4)
+            _mm_storeu_si128((__m128i *)((int *)d + i), _mm256_cvttpd_epi32(_mm256_loadu_pd((const double *)s + i)));
+    }
+
+    return i;
+}
+#endif
+
+/* [ Functions ] */
+
+/*
+ * convert_array()
+ * ----------------------
+ * Description:
+ *      Converts a whole array from one type to another.
+ */
+int convert_array(void *dst, Fetch_Type dst_type, const void *src, Fetch_Type src_type, int len, Convert_Mode mode)
+{
+    if (dst == NULL || src == NULL || len < 0 || (unsigned)dst_type > TYPE_DOUBLE || (unsigned)src_type > TYPE_DOUBLE)
+    {
+        print_log("[ERROR]", RED, "Invalid conversion arguments\n");
+        return -1;
+    }
+
+    Convert_Kind sk = convert_kind(src_type);
+    Convert_Kind dk = convert_kind(dst_type);
+
+    /* Same representation, nothing to convert. */
+    if (sk == dk)
+    {
+        if (dst != src)
+            memmove(dst, src, (size_t)len * type_sizes[src_type]);
+        return len;
+    }
+
+    int done = 0;
+
+#ifdef UTILS_X86_SIMD
+    if (cpu_tier() >= CPU_TIER_AVX2)
+        done = convert_avx2(dst, dk, src, sk, len, mode);
+#endif
+
+    return done + convert_kernels[src_type][dst_type](
+        (char *)dst + (size_t)done * type_sizes[dst_type],
+        (const char *)src + (size_t)done * type_sizes[src_type],
+        len - done, mode);
+}
+
+/* convert_utils.c */
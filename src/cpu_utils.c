@@ -0,0 +1,138 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : cpu_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at picking kernels for the CPU.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <cpu_utils.h>
+
+/* [ Variables ] */
+
+CPU_Tier cpu_active_tier = CPU_TIER_SCALAR;
+
+static CPU_Tier cpu_detected = CPU_TIER_SCALAR;
+
+static const char *const cpu_names[CPU_TIERS] = {
+    [CPU_TIER_SCALAR] = "scalar",
+    [CPU_TIER_SSE2] = "sse2",
+    [CPU_TIER_AVX2] = "avx2",
+    [CPU_TIER_AVX512] = "avx512",
+};
+
+/* [ Helpers ] */
+
+/*
+ * cpu_probe()
+ * ----------------------
+ * Description:
+ *      Reads the CPUID feature bits into a tier.
+ */
+static CPU_Tier cpu_probe(void)
+{
+#ifdef UTILS_X86_SIMD
+    __builtin_cpu_init();
+
+    if (!__builtin_cpu_supports("sse2"))
+        return CPU_TIER_SCALAR;
+    if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("popcnt"))
+        return CPU_TIER_SSE2;
+    if (!__builtin_cpu_supports("avx512f"))
+        return CPU_TIER_AVX2;
+
+    return CPU_TIER_AVX512;
+#else
+    return CPU_TIER_SCALAR;
+#endif
+}
+
+/*
+ * cpu_init()
+ * ----------------------
+ * Description:
+ *      Probes the CPU and applies LIBUTILS_CPU_TIER,
+ *      once, when the library is loaded.
+ */
+__attribute__((constructor))
+static void cpu_init(void)
+{
+    cpu_detected = cpu_probe();
+    cpu_active_tier = cpu_detected;
+
+    const char *env = getenv(CPU_TIER_ENV);
+    if (env == NULL || env[0] == '\0')
+        return;
+
+    for (int t = 0; t < CPU_TIERS; ++t)
+    {
+        if (strcmp(env, cpu_names[t]) != 0)
+            continue;
+
+        if ((CPU_Tier)t > cpu_detected)
+            print_log("[WARNING]", YELLOW, "%s=%s is not supported by this CPU, using %s\n",
+                      CPU_TIER_ENV, env, cpu_names[cpu_detected]);
+        else
+            cpu_active_tier = (CPU_Tier)t;
+
+        return;
+    }
+
+    print_log("[WARNING]", YELLOW, "Unknown %s=%s, expected scalar, sse2, avx2 or avx512\n", CPU_TIER_ENV, env);
+}
+
+/* [ Functions ] */
+
+/*
+ * cpu_detected_tier()
+ * ----------------------
+ * Description:
+ *      Returns the highest tier the CPU supports.
+ */
+CPU_Tier cpu_detected_tier(void)
+{
+    return cpu_detected;
+}
+
+/*
+ * cpu_set_tier()
+ * ----------------------
+ * Description:
+ *      Forces the tier used from now on.
+ */
+int cpu_set_tier(CPU_Tier tier)
+{
+    if ((unsigned)tier >= CPU_TIERS)
+        return -1;
+
+    if (tier > cpu_detected)
+    {
+        print_log("[ERROR]", RED, "CPU tier %s is not supported by this CPU (%s)\n",
+                  cpu_names[tier], cpu_names[cpu_detected]);
+        return -1;
+    }
+
+    cpu_active_tier = tier;
+    return 0;
+}
+
+/*
+ * cpu_tier_name()
+ * ----------------------
+ * Description:
+ *      Returns the name of a tier.
+ */
+const char *cpu_tier_name(CPU_Tier tier)
+{
+    return (unsigned)tier < CPU_TIERS ? cpu_names[tier] : "?";
+}
+
+/* cpu_utils.c */
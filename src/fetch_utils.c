@@ -14,105 +14,498 @@
 /* [ Headers ] */
 #include <custom_utils.h>
 #include <fetch_utils.h>
+#include <limits.h>
+#include <poll.h>
+#include <time.h>
+
+/* [ Streams ] */
 
 /*
- * fetch_array()
+ * fetch_clock()
  * ----------------------
  * Description:
- *      Reads array elements with fetch().
- *      Has the option to display remaining elements.
+ *      Milliseconds on the monotonic clock.
  */
-void fetch_array(void *arr, int len, const char *prompt, Fetch_Type type, double min, double max, bool disp_cnt)
+static long long fetch_clock(void)
 {
-    char buffer[BUFFER];
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+/*
+ * fetch_deadline()
+ * ----------------------
+ * Description:
+ *      Turns a timeout into an absolute deadline, -1 meaning none.
+ */
+static long long fetch_deadline(int timeout)
+{
+    return timeout < 0 ? -1 : fetch_clock() + timeout;
+}
+
+/*
+ * fetch_remaining()
+ * ----------------------
+ * Description:
+ *      Milliseconds left until the deadline, as poll() expects them.
+ */
+static int fetch_remaining(long long deadline)
+{
+    if (deadline < 0)
+        return -1;
+
+    long long left = deadline - fetch_clock();
+    return left <= 0 ? 0 : left > INT_MAX ? INT_MAX : (int)left;
+}
+
+/*
+ * fetch_stream_ready()
+ * ----------------------
+ * Description:
+ *      Checks whether the buffer holds a line (or as much of one as
+ *      fits in size), or whether the stream has ended.
+ */
+static bool fetch_stream_ready(const Fetch_Stream *stream, size_t size, size_t *line_len)
+{
+    size_t avail = stream->tail - stream->head;
+    size_t limit = size - 1 < FETCH_STREAM_BUFFER ? size - 1 : FETCH_STREAM_BUFFER;
+    const char *nl = memchr(stream->buf + stream->head, '\n', avail < limit ? avail : limit);
+
+    if (nl != NULL)
+        *line_len = (size_t)(nl - (stream->buf + stream->head)) + 1;
+    else if (avail >= limit || stream->eof)
+        *line_len = avail < limit ? avail : limit;
+    else
+        return false;
 
-    for (int i = 0; i < len; ++i) 
+    return true;
+}
+
+/*
+ * fetch_stream_fill()
+ * ----------------------
+ * Description:
+ *      Reads whatever the descriptor has into the buffer, once poll()
+ *      said it would not block.
+ */
+static Fetch_Status fetch_stream_fill(Fetch_Stream *stream)
+{
+    if (stream->tail - stream->head == FETCH_STREAM_BUFFER)
+        return FETCH_OK;
+
+    if (stream->head > 0)
     {
-        if (disp_cnt)
-            snprintf(buffer, sizeof(buffer), "%s [%d]/[%d]: ", prompt, i + 1, len);
-        else
-            snprintf(buffer, sizeof(buffer), "%s", prompt);
+        memmove(stream->buf, stream->buf + stream->head, stream->tail - stream->head);
+        stream->tail -= stream->head;
+        stream->head = 0;
+    }
+
+    ssize_t got = read(stream->fd, stream->buf + stream->tail, FETCH_STREAM_BUFFER - stream->tail);
+
+    if (got > 0)
+        stream->tail += (size_t)got;
+    else if (got == 0)
+        stream->eof = true;
+    else if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+        return FETCH_ERROR;
+
+    return FETCH_OK;
+}
+
+/*
+ * fetch_stream_read()
+ * ----------------------
+ * Description:
+ *      Reads one line from a stream before an absolute deadline.
+ */
+static Fetch_Status fetch_stream_read(Fetch_Stream *stream, char *line, size_t size, long long deadline)
+{
+    size_t len;
+
+    while (!fetch_stream_ready(stream, size, &len))
+    {
+        struct pollfd pfd = { .fd = stream->fd, .events = POLLIN };
+        int ready = poll(&pfd, 1, fetch_remaining(deadline));
 
-        void *element = (char *)arr + i * type_sizes[type];
-        fetch_array_element(element, buffer, min, max, type);
+        if (ready == 0)
+            return FETCH_TIMEOUT;
+        else if (ready < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return FETCH_ERROR;
+        }
+
+        if (fetch_stream_fill(stream) != FETCH_OK)
+            return FETCH_ERROR;
     }
+
+    if (len == 0)
+        return FETCH_EOF;
+
+    memcpy(line, stream->buf + stream->head, len);
+    line[len] = '\0';
+    stream->head += len;
+    return FETCH_OK;
 }
 
 /*
- * Function: fetch_number()
+ * fetch_stream_init()
  * ----------------------
  * Description:
- *      Outputs prompt, reads input using fgets(),
- *      converts it to the selected type, and validates 
- *      the input.
- * 
- * Notes:
- *      - Uses print_error() and print_warning() from print_utils.h
- *      - Uses CONVERT_INPUT() from custom_utils.h
+ *      Binds a stream to a file descriptor.
  */
-void fetch_number(void *input, const char *prompt, double min, double max, Fetch_Type type)
+void fetch_stream_init(Fetch_Stream *stream, int fd)
+{
+    stream->fd = fd;
+    stream->head = 0;
+    stream->tail = 0;
+    stream->eof = false;
+}
+
+/*
+ * fetch_stream_line()
+ * ----------------------
+ * Description:
+ *      Reads one line, waiting at most timeout milliseconds.
+ */
+Fetch_Status fetch_stream_line(Fetch_Stream *stream, char *line, size_t size, int timeout)
+{
+    if (stream == NULL || line == NULL || size < 2)
+        return FETCH_ERROR;
+
+    return fetch_stream_read(stream, line, size, fetch_deadline(timeout));
+}
+
+/*
+ * fetch_stream_number()
+ * ----------------------
+ * Description:
+ *      Reads one line and parses it as a number in [min, max].
+ */
+Fetch_Status fetch_stream_number(Fetch_Stream *stream, double *value, double min, double max, int timeout)
 {
     char buffer[BUFFER];
+    char *endptr;
+
+    Fetch_Status status = fetch_stream_line(stream, buffer, sizeof(buffer), timeout);
+    if (status != FETCH_OK)
+        return status;
+
+    errno = 0;
+    double parsed = strtod(buffer, &endptr);
+
+    if (is_empty(buffer) || validate(endptr, parsed, min, max))
+        return FETCH_INVALID;
+
+    *value = parsed;
+    return FETCH_OK;
+}
+
+/*
+ * fetch_stream_wait()
+ * ----------------------
+ * Description:
+ *      Waits until one of several streams can be read
+ *      without blocking.
+ */
+Fetch_Status fetch_stream_wait(Fetch_Stream *const *streams, int count, int timeout, int *ready)
+{
+    struct pollfd fds[FETCH_STREAM_MAX];
+    long long deadline = fetch_deadline(timeout);
+    size_t len;
+
+    if (streams == NULL || ready == NULL || count < 1 || count > FETCH_STREAM_MAX)
+        return FETCH_ERROR;
 
     do
     {
-        char *endptr;
-        errno = 0;
-
-        printf("%s", prompt);
+        /* Buffered lines and ended streams come first: they need no poll(). */
+        for (int i = 0; i < count; ++i)
+        {
+            if (streams[i] != NULL && streams[i]->fd >= 0 && fetch_stream_ready(streams[i], BUFFER, &len))
+            {
+                *ready = i;
+                return FETCH_OK;
+            }
+        }
 
-        if (fgets(buffer, sizeof(buffer), stdin))
+        /* Negative descriptors are skipped by poll(). */
+        for (int i = 0; i < count; ++i)
         {
-            double value = strtod(buffer, &endptr);
+            fds[i].fd = streams[i] != NULL ? streams[i]->fd : -1;
+            fds[i].events = POLLIN;
+            fds[i].revents = 0;
+        }
 
-            if (is_empty(buffer)) 
-            {
-                print_log("[ERROR]", RED, "Input cannot be empty of a new line character\n");
+        int polled = poll(fds, (nfds_t)count, fetch_remaining(deadline));
+
+        if (polled == 0)
+            return FETCH_TIMEOUT;
+        else if (polled < 0)
+        {
+            if (errno == EINTR)
                 continue;
-            }
-            else if (validate(endptr, strtod(buffer, &endptr), min, max))
+            return FETCH_ERROR;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            if (fds[i].revents != 0 && fetch_stream_fill(streams[i]) != FETCH_OK)
             {
-                print_log("[ERROR]", RED, "Input is invalid: non-number or invalid range\n");
-                print_log("[WARNING]", YELLOW, "Input must be in range [ %.1lf ] => [ %.1lf ]\n", min, max);
-                continue;
+                *ready = i;
+                return FETCH_ERROR;
             }
-
-            convert_input(input, value, type);
-            break;
         }
-        else
-            print_log("[ERROR]", RED, "Error reading input\n");
 
     } while (true);
 }
 
+/* [ Prompting ] */
+
 /*
- * Function: fetch_string()
+ * fetch_prompt()
  * ----------------------
  * Description:
- *      Fetches a string value from the user.
+ *      Writes a prompt to ctx->out, flushing it only when the
+ *      input is interactive.
  */
-void fetch_string(char *input, const char *prompt) 
+static void fetch_prompt(Utils_Context *ctx, const char *prompt)
+{
+    if (prompt[0] == '\0')
+        return;
+
+    context_begin(ctx, ctx->out);
+    context_write(ctx, prompt, strlen(prompt));
+    context_end(ctx);
+
+    if (ctx->interactive)
+        fflush(ctx->out);
+}
+
+/*
+ * fetch_line()
+ * ----------------------
+ * Description:
+ *      Reads one line from the context's stream, or from ctx->in
+ *      when it has none.
+ */
+static Fetch_Status fetch_line(Utils_Context *ctx, char *buffer, size_t size, long long deadline)
+{
+    if (ctx->stream != NULL)
+        return fetch_stream_read(ctx->stream, buffer, size, deadline);
+
+    if (fgets(buffer, (int)size, ctx->in))
+        return FETCH_OK;
+
+    return feof(ctx->in) ? FETCH_EOF : FETCH_ERROR;
+}
+
+/*
+ * fetch_parse()
+ * ----------------------
+ * Description:
+ *      Outputs prompt, reads input and validates it until a number
+ *      in range is entered, or once if ctx->retry is false.
+ */
+static Fetch_Status fetch_parse(Utils_Context *ctx, const char *prompt, double min, double max, long long deadline, double *value)
 {
     char buffer[BUFFER];
 
     do
     {
-        printf("%s", prompt);
+        char *endptr;
+
+        fetch_prompt(ctx, prompt);
 
-        if (fgets(buffer, BUFFER, stdin) == NULL)
+        Fetch_Status status = fetch_line(ctx, buffer, sizeof(buffer), deadline);
+
+        if (status == FETCH_ERROR)
+            print_log_ctx(ctx, "[ERROR]", RED, "Error reading input\n");
+        if (status != FETCH_OK)
+            return status;
+
+        errno = 0;
+        double parsed = strtod(buffer, &endptr);
+
+        if (is_empty(buffer)) 
         {
-            print_log("[ERROR]", RED, "Error reading input\n");
-            print_log("[WARNING]", YELLOW, "Buffer cannot be empty\n");
-            continue;
+            print_log_ctx(ctx, "[ERROR]", RED, "Input cannot be empty of a new line character\n");
+        }
+        else if (validate(endptr, parsed, min, max))
+        {
+            print_log_ctx(ctx, "[ERROR]", RED, "Input is invalid: non-number or invalid range\n");
+            print_log_ctx(ctx, "[WARNING]", YELLOW, "Input must be in range [ %.1lf ] => [ %.1lf ]\n", min, max);
+        }
+        else
+        {
+            *value = parsed;
+            return FETCH_OK;
         }
 
-        strncpy(input, buffer, BUFFER - 1);
-        input[BUFFER - 1] = '\0';
-        input[strcspn(input, "\n")] = '\0';
-        break;
+    } while (ctx->retry);
 
-    } while (true);
+    return FETCH_INVALID;
+}
+
+/* [ Functions ] */
+
+/*
+ * FETCH_DEFINE()
+ * ----------------------
+ * Description:
+ *      Generates fetch_fill_<type>(), whose loop only ever stores one
+ *      type, and the public fetch_number_<type>() and fetch_array_<type>().
+ */
+#define FETCH_DEFINE(suffix, T)                                                 \
+static Fetch_Status fetch_fill_##suffix(Utils_Context *ctx, T *arr, int len, const char *prompt, double min, double max, bool disp_cnt) \
+{                                                                               \
+    char buffer[BUFFER];                                                        \
+    long long deadline = fetch_deadline(ctx->timeout);                          \
+                                                                                \
+    for (int i = 0; i < len; ++i)                                               \
+    {                                                                           \
+        double value;                                                           \
+                                                                                \
+        if (disp_cnt)                                                           \
+            snprintf(buffer, sizeof(buffer), "%s [%d]/[%d]: ", prompt, i + 1, len); \
+        else                                                                    \
+            snprintf(buffer, sizeof(buffer), "%s", prompt);                     \
+                                                                                \
+        Fetch_Status status = fetch_parse(ctx, buffer, min, max, deadline, &value); \
+        if (status != FETCH_OK)                                                 \
+            return status;                                                      \
+                                                                                \
+        arr[i] = (T)value;                                                      \
+    }                                                                           \
+                                                                                \
+    return FETCH_OK;                                                            \
+}                                                                               \
+                                                                                \
+void fetch_number_##suffix(T *input, const char *prompt, double min, double max) \
+{                                                                               \
+    fetch_fill_##suffix(context_default(), input, 1, prompt, min, max, false);  \
+}                                                                               \
+                                                                                \
+void fetch_array_##suffix(T *arr, int len, const char *prompt, double min, double max, bool disp_cnt) \
+{                                                                               \
+    fetch_fill_##suffix(context_default(), arr, len, prompt, min, max, disp_cnt); \
+}
+
+FETCH_DEFINE(int, int)
+FETCH_DEFINE(long, long)
+FETCH_DEFINE(long_long, long long)
+FETCH_DEFINE(float, float)
+FETCH_DEFINE(double, double)
+
+/*
+ * fetch_array()
+ * ----------------------
+ * Description:
+ *      Reads array elements with the typed fetch_array_<type>().
+ *      Has the option to display remaining elements.
+ */
+void fetch_array(void *arr, int len, const char *prompt, Fetch_Type type, double min, double max, bool disp_cnt)
+{
+    fetch_array_ctx(context_default(), arr, len, prompt, type, min, max, disp_cnt);
+}
+
+/*
+ * fetch_array_ctx()
+ * ----------------------
+ * Description:
+ *      fetch_array() on an explicit context, stopping at the first
+ *      element that cannot be read.
+ */
+Fetch_Status fetch_array_ctx(Utils_Context *ctx, void *arr, int len, const char *prompt, Fetch_Type type, double min, double max, bool disp_cnt)
+{
+    switch (type)
+    {
+        case TYPE_INT:          return fetch_fill_int(ctx, arr, len, prompt, min, max, disp_cnt);
+        case TYPE_LONG:         return fetch_fill_long(ctx, arr, len, prompt, min, max, disp_cnt);
+        case TYPE_LONG_LONG:    return fetch_fill_long_long(ctx, arr, len, prompt, min, max, disp_cnt);
+        case TYPE_FLOAT:        return fetch_fill_float(ctx, arr, len, prompt, min, max, disp_cnt);
+        case TYPE_DOUBLE:       return fetch_fill_double(ctx, arr, len, prompt, min, max, disp_cnt);
+        default:
+            print_log_ctx(ctx, "[ERROR]", RED, "Unsupported type for array element\n");
+            return FETCH_ERROR;
+    }
+}
+
+/*
+ * Function: fetch_number()
+ * ----------------------
+ * Description:
+ *      Outputs prompt, reads input using fgets(),
+ *      converts it to the selected type, and validates 
+ *      the input.
+ * 
+ * Notes:
+ *      - Uses print_log() from print_utils.h
+ *      - Uses convert_input() from fetch_utils.h
+ */
+void fetch_number(void *input, const char *prompt, double min, double max, Fetch_Type type)
+{
+    fetch_number_ctx(context_default(), input, prompt, min, max, type);
+}
+
+/*
+ * fetch_number_ctx()
+ * ----------------------
+ * Description:
+ *      fetch_number() on an explicit context. input is only
+ *      written on success.
+ */
+Fetch_Status fetch_number_ctx(Utils_Context *ctx, void *input, const char *prompt, double min, double max, Fetch_Type type)
+{
+    double value;
+
+    Fetch_Status status = fetch_parse(ctx, prompt, min, max, fetch_deadline(ctx->timeout), &value);
+    if (status == FETCH_OK)
+        convert_input(input, value, type);
+
+    return status;
+}
+
+/*
+ * Function: fetch_string()
+ * ----------------------
+ * Description:
+ *      Fetches a string value from the user.
+ */
+void fetch_string(char *input, const char *prompt) 
+{
+    fetch_string_ctx(context_default(), input, prompt);
+}
+
+/*
+ * fetch_string_ctx()
+ * ----------------------
+ * Description:
+ *      fetch_string() on an explicit context.
+ */
+Fetch_Status fetch_string_ctx(Utils_Context *ctx, char *input, const char *prompt)
+{
+    char buffer[BUFFER];
+
+    fetch_prompt(ctx, prompt);
+
+    Fetch_Status status = fetch_line(ctx, buffer, BUFFER, fetch_deadline(ctx->timeout));
+
+    if (status == FETCH_ERROR)
+    {
+        print_log_ctx(ctx, "[ERROR]", RED, "Error reading input\n");
+        print_log_ctx(ctx, "[WARNING]", YELLOW, "Buffer cannot be empty\n");
+    }
+    if (status != FETCH_OK)
+        return status;
+
+    strncpy(input, buffer, BUFFER - 1);
+    input[BUFFER - 1] = '\0';
+    input[strcspn(input, "\n")] = '\0';
+    return FETCH_OK;
 }
 
 /*
@@ -124,44 +517,75 @@ void fetch_string(char *input, const char *prompt)
  */
 int fetch_matrix(void ***matrix, int rows, int cols, const char *prompt, Fetch_Type type, double min, double max, bool disp_cnt)
 {
-    bool is_interactive = isatty(fileno(stdin));
+    return fetch_matrix_ctx(context_default(), matrix, rows, cols, prompt, type, min, max, disp_cnt) == FETCH_OK ? 0 : -1;
+}
 
-    *matrix = malloc(rows * sizeof(void *));
+/*
+ * fetch_matrix_ctx()
+ * --------------
+ * Description:
+ *      fetch_matrix() on an explicit context, allocating through
+ *      the context's allocator. The matrix is freed again if a
+ *      row cannot be read.
+ */
+Fetch_Status fetch_matrix_ctx(Utils_Context *ctx, void ***matrix, int rows, int cols, const char *prompt, Fetch_Type type, double min, double max, bool disp_cnt)
+{
+    Fetch_Status status = FETCH_OK;
+    int timeout = ctx->timeout;
+    long long deadline = fetch_deadline(timeout);
+
+    if ((unsigned)type > TYPE_DOUBLE)
+    {
+        print_log_ctx(ctx, "[ERROR]", RED, "Unsupported type for array element\n");
+        return FETCH_ERROR;
+    }
+
+    *matrix = context_alloc(ctx, rows * sizeof(void *));
     if (*matrix == NULL) 
     {
-        print_log("[ERROR]", RED, "Memory allocation failed for matrix rows\n");
-        return -1;
+        print_log_ctx(ctx, "[ERROR]", RED, "Memory allocation failed for matrix rows\n");
+        return FETCH_ERROR;
     }
 
     for (int i = 0; i < rows; ++i) 
     {
         size_t row_size = type_sizes[type] * cols;
-        (*matrix)[i] = malloc(row_size);
+        (*matrix)[i] = context_alloc(ctx, row_size);
 
         if ((*matrix)[i] == NULL) 
         {
-            print_log("[ERROR]", RED, "Memory allocation failed for a matrix row\n");
+            print_log_ctx(ctx, "[ERROR]", RED, "Memory allocation failed for a matrix row\n");
+            status = FETCH_ERROR;
+        }
+        else
+        {
+            char row_prompt[BUFFER];
 
-            for (int j = 0; j < i; ++j)
-                free((*matrix)[j]);
+            if (ctx->interactive)
+                snprintf(row_prompt, sizeof(row_prompt), "%s (Row %d)", prompt, i + 1);
+            else 
+                row_prompt[0] = '\0';
 
-            free(*matrix);
-            return -1;
-        }
+            /* The deadline covers the whole matrix, not each row. */
+            ctx->timeout = fetch_remaining(deadline);
+            status = fetch_array_ctx(ctx, (*matrix)[i], cols, row_prompt, type, min, max, disp_cnt);
+            ctx->timeout = timeout;
 
-        char row_prompt[BUFFER];
+            if (status == FETCH_OK)
+                continue;
 
-        if (is_interactive)
-            snprintf(row_prompt, sizeof(row_prompt), "%s (Row %d)", prompt, i + 1);
-        else 
-            row_prompt[0] = '\0';
+            i++;
+        }
 
-        fetch_array((*matrix)[i], cols, row_prompt, type, min, max, disp_cnt);
+        for (int j = 0; j < i; ++j)
+            context_release(ctx, (*matrix)[j]);
+
+        context_release(ctx, *matrix);
+        *matrix = NULL;
+        return status;
     }
 
-    return 0;
+    return FETCH_OK;
 }
 
-
-
-/* fetch_utils.c */
\ No newline at end of file
+/* fetch_utils.c */
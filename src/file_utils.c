@@ -0,0 +1,959 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : file_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at reading numeric files in bulk.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <file_utils.h>
+#include <fcntl.h>
+#include <float.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/stat.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#define FILE_HAVE_URING     // io_uring can be tried at runtime
+#endif
+#endif
+
+/* [ Enums ] */
+
+typedef enum
+{
+    SLOT_FREE,      // buffer unused
+    SLOT_RUNNING,   // read queued or in progress
+    SLOT_READY,     // read finished, waiting to be delivered
+} File_Slot_State;
+
+/* [ Structs ] */
+
+/* One buffer and the read it currently holds. */
+typedef struct
+{
+    char *buf;              // chunk_size bytes
+    int file;               // index of the file being read
+    int fd;                 // its descriptor
+    off_t offset;           // where the chunk starts in the file
+    size_t want;            // bytes the chunk should hold
+    size_t got;             // bytes read so far
+    int error;              // errno of a failed read, 0 otherwise
+    File_Slot_State state;  // only touched by the calling thread
+} File_Slot;
+
+#ifdef FILE_HAVE_URING
+/* The mapped rings of an io_uring instance. */
+typedef struct
+{
+    int fd;
+    void *sq_ptr, *cq_ptr;
+    size_t sq_size, cq_size;
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+    unsigned *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_cqe *cqes;
+    unsigned pending;       // SQEs written but not yet submitted
+} File_Uring;
+#endif
+
+typedef struct
+{
+    const char *const *paths;
+    int count;
+    File_Chunk_Fn fn;
+    void *user;
+
+    size_t chunk;
+    int depth;
+    File_Slot *slots;
+    char *buffers;
+
+    /* Submission cursor. */
+    int next_file;
+    int next_fd;
+    off_t next_offset;
+    off_t next_size;
+
+    /* Delivery state, per file. */
+    int *fds;
+    off_t *sizes;
+    off_t *delivered;
+
+    int in_flight;
+    bool failed;
+
+    /* pread() pool. */
+    bool use_uring;
+    pthread_t *workers;
+    int worker_cnt;
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    int *queue;             // slots waiting for a thread, circular
+    int queue_head;
+    int queued;
+    int *finished;          // slots read since the last wait
+    int completed;
+    bool stop;
+
+#ifdef FILE_HAVE_URING
+    File_Uring ring;
+#endif
+} File_Reader;
+
+/* State of the number parser for one file. */
+typedef struct
+{
+    void *arr;
+    int len;
+    int count;
+    char carry[FILE_TOKEN_MAX + 1];     // token split across two chunks
+    int carry_len;
+} File_Parse;
+
+typedef struct
+{
+    File_Parse *files;
+    const char *const *paths;
+    Fetch_Type type;
+    double min;
+    double max;
+} File_Fetch;
+
+/* [ io_uring Backend ] */
+
+#ifdef FILE_HAVE_URING
+
+/*
+ * file_uring_init()
+ * ----------------------
+ * Description:
+ *      Sets up a ring and registers the slot buffers with it.
+ *      Returns -1, leaving nothing behind, if the kernel refuses.
+ */
+static int file_uring_init(File_Reader *r)
+{
+    File_Uring *ring = &r->ring;
+    struct io_uring_params params;
+
+    memset(ring, 0, sizeof(*ring));
+    memset(&params, 0, sizeof(params));
+
+    ring->fd = (int)syscall(__NR_io_uring_setup, (unsigned)r->depth, &params);
+    if (ring->fd < 0)
+        return -1;
+
+    ring->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring->sq_size = ring->sq_size > ring->cq_size ? ring->sq_size : ring->cq_size;
+        ring->cq_size = 0;
+    }
+
+    ring->sq_ptr = mmap(NULL, ring->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ptr == MAP_FAILED)
+        goto fail_ring;
+
+    ring->cq_ptr = ring->sq_ptr;
+    if (ring->cq_size > 0)
+    {
+        ring->cq_ptr = mmap(NULL, ring->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ptr == MAP_FAILED)
+            goto fail_sq;
+    }
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED)
+        goto fail_cq;
+
+    ring->sq_tail = (unsigned *)((char *)ring->sq_ptr + params.sq_off.tail);
+    ring->sq_mask = (unsigned *)((char *)ring->sq_ptr + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)((char *)ring->sq_ptr + params.sq_off.array);
+    ring->cq_head = (unsigned *)((char *)ring->cq_ptr + params.cq_off.head);
+    ring->cq_tail = (unsigned *)((char *)ring->cq_ptr + params.cq_off.tail);
+    ring->cq_mask = (unsigned *)((char *)ring->cq_ptr + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)((char *)ring->cq_ptr + params.cq_off.cqes);
+
+    /* Registered buffers are pinned once, instead of on every read. */
+    struct iovec *iov = malloc((size_t)r->depth * sizeof(struct iovec));
+    if (iov == NULL)
+        goto fail_sqes;
+
+    for (int i = 0; i < r->depth; ++i)
+    {
+        iov[i].iov_base = r->slots[i].buf;
+        iov[i].iov_len = r->chunk;
+    }
+
+    int reg = (int)syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS, iov, (unsigned)r->depth);
+    free(iov);
+
+    if (reg < 0)
+        goto fail_sqes;
+
+    return 0;
+
+fail_sqes:
+    munmap(ring->sqes, ring->sqes_size);
+fail_cq:
+    if (ring->cq_ptr != ring->sq_ptr)
+        munmap(ring->cq_ptr, ring->cq_size);
+fail_sq:
+    munmap(ring->sq_ptr, ring->sq_size);
+fail_ring:
+    close(ring->fd);
+    return -1;
+}
+
+/*
+ * file_uring_free()
+ * ----------------------
+ * Description:
+ *      Unmaps and closes the ring.
+ */
+static void file_uring_free(File_Reader *r)
+{
+    File_Uring *ring = &r->ring;
+
+    munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ptr != ring->sq_ptr)
+        munmap(ring->cq_ptr, ring->cq_size);
+    munmap(ring->sq_ptr, ring->sq_size);
+    close(ring->fd);
+}
+
+/*
+ * file_uring_queue()
+ * ----------------------
+ * Description:
+ *      Writes a READ_FIXED for the unread part of a slot.
+ */
+static void file_uring_queue(File_Reader *r, int idx)
+{
+    File_Uring *ring = &r->ring;
+    File_Slot *slot = &r->slots[idx];
+    unsigned tail = *ring->sq_tail;
+    unsigned pos = tail & *ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[pos];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READ_FIXED;
+    sqe->fd = slot->fd;
+    sqe->off = (unsigned long long)(slot->offset + (off_t)slot->got);
+    sqe->addr = (unsigned long long)(uintptr_t)(slot->buf + slot->got);
+    sqe->len = (unsigned)(slot->want - slot->got);
+    sqe->buf_index = (unsigned short)idx;
+    sqe->user_data = (unsigned long long)idx;
+
+    ring->sq_array[pos] = pos;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring->pending++;
+}
+
+/*
+ * file_uring_wait()
+ * ----------------------
+ * Description:
+ *      Submits the queued reads, waits for at least one completion
+ *      and marks every finished slot ready.
+ */
+static int file_uring_wait(File_Reader *r)
+{
+    File_Uring *ring = &r->ring;
+    bool reaped = false;
+
+    while (!reaped)
+    {
+        int ret = (int)syscall(__NR_io_uring_enter, ring->fd, ring->pending, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+
+        if (ret < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+
+        ring->pending -= (unsigned)ret < ring->pending ? (unsigned)ret : ring->pending;
+
+        unsigned head = *ring->cq_head;
+        unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+        for (; head != tail; ++head)
+        {
+            struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+            File_Slot *slot = &r->slots[cqe->user_data];
+
+            if (cqe->res < 0)
+                slot->error = -cqe->res;
+            else if (cqe->res == 0)
+                slot->error = EIO;      // the file shrank while being read
+            else
+                slot->got += (size_t)cqe->res;
+
+            /* A short read is resubmitted for the rest of the chunk. */
+            if (slot->error == 0 && slot->got < slot->want)
+                file_uring_queue(r, (int)cqe->user_data);
+            else
+            {
+                slot->state = SLOT_READY;
+                reaped = true;
+            }
+        }
+
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    return 0;
+}
+
+#endif // FILE_HAVE_URING
+
+/* [ pread() Backend ] */
+
+/*
+ * file_worker()
+ * ----------------------
+ * Description:
+ *      Pool thread: takes queued slots and reads them whole. Slots
+ *      are handed over through the queue and finished lists, so the
+ *      thread never looks at a slot it does not own.
+ */
+static void *file_worker(void *arg)
+{
+    File_Reader *r = arg;
+
+    pthread_mutex_lock(&r->lock);
+
+    while (true)
+    {
+        while (r->queued == 0 && !r->stop)
+            pthread_cond_wait(&r->work, &r->lock);
+
+        if (r->stop)
+            break;
+
+        int idx = r->queue[r->queue_head];
+        File_Slot *slot = &r->slots[idx];
+
+        r->queue_head = (r->queue_head + 1) % r->depth;
+        r->queued--;
+        pthread_mutex_unlock(&r->lock);
+
+        while (slot->got < slot->want && slot->error == 0)
+        {
+            ssize_t got = pread(slot->fd, slot->buf + slot->got, slot->want - slot->got, slot->offset + (off_t)slot->got);
+
+            if (got > 0)
+                slot->got += (size_t)got;
+            else if (got == 0)
+                slot->error = EIO;
+            else if (errno != EINTR)
+                slot->error = errno;
+        }
+
+        pthread_mutex_lock(&r->lock);
+        r->finished[r->completed++] = idx;
+        pthread_cond_signal(&r->done);
+    }
+
+    pthread_mutex_unlock(&r->lock);
+    return NULL;
+}
+
+/*
+ * file_pool_init()
+ * ----------------------
+ * Description:
+ *      Starts the pread() threads.
+ */
+static int file_pool_init(File_Reader *r, int threads)
+{
+    pthread_mutex_init(&r->lock, NULL);
+    pthread_cond_init(&r->work, NULL);
+    pthread_cond_init(&r->done, NULL);
+
+    r->workers = malloc((size_t)threads * sizeof(pthread_t));
+    r->queue = malloc((size_t)r->depth * sizeof(int));
+    r->finished = malloc((size_t)r->depth * sizeof(int));
+
+    if (r->workers == NULL || r->queue == NULL || r->finished == NULL)
+        return -1;
+
+    for (r->worker_cnt = 0; r->worker_cnt < threads; r->worker_cnt++)
+    {
+        if (pthread_create(&r->workers[r->worker_cnt], NULL, file_worker, r) != 0)
+            break;
+    }
+
+    return r->worker_cnt > 0 ? 0 : -1;
+}
+
+/*
+ * file_pool_free()
+ * ----------------------
+ * Description:
+ *      Stops and joins the pread() threads.
+ */
+static void file_pool_free(File_Reader *r)
+{
+    pthread_mutex_lock(&r->lock);
+    r->stop = true;
+    pthread_cond_broadcast(&r->work);
+    pthread_mutex_unlock(&r->lock);
+
+    for (int i = 0; i < r->worker_cnt; ++i)
+        pthread_join(r->workers[i], NULL);
+
+    free(r->workers);
+    free(r->queue);
+    free(r->finished);
+    pthread_cond_destroy(&r->done);
+    pthread_cond_destroy(&r->work);
+    pthread_mutex_destroy(&r->lock);
+}
+
+/*
+ * file_pool_wait()
+ * ----------------------
+ * Description:
+ *      Waits for at least one pool read and takes ownership of every
+ *      finished slot.
+ */
+static int file_pool_wait(File_Reader *r)
+{
+    pthread_mutex_lock(&r->lock);
+
+    while (r->completed == 0)
+        pthread_cond_wait(&r->done, &r->lock);
+
+    for (int i = 0; i < r->completed; ++i)
+        r->slots[r->finished[i]].state = SLOT_READY;
+
+    r->completed = 0;
+    pthread_mutex_unlock(&r->lock);
+    return 0;
+}
+
+/* [ Reader ] */
+
+/*
+ * file_close()
+ * ----------------------
+ * Description:
+ *      Closes a file whose chunks are all delivered.
+ */
+static void file_close(File_Reader *r, int file)
+{
+    if (r->fds[file] >= 0)
+        close(r->fds[file]);
+
+    r->fds[file] = -1;
+}
+
+/*
+ * file_advance()
+ * ----------------------
+ * Description:
+ *      Moves the submission cursor to the next file with unread bytes,
+ *      opening it. Empty files are delivered on the spot.
+ */
+static int file_advance(File_Reader *r)
+{
+    while (r->next_offset >= r->next_size && r->next_file < r->count)
+    {
+        int file = ++r->next_file;
+
+        if (file >= r->count)
+            break;
+
+        struct stat st;
+        int fd = open(r->paths[file], O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0 || fstat(fd, &st) != 0)
+        {
+            print_log("[ERROR]", RED, "Cannot open \"%s\": %s\n", r->paths[file], strerror(errno));
+            if (fd >= 0)
+                close(fd);
+            return -1;
+        }
+
+        r->fds[file] = fd;
+        r->sizes[file] = st.st_size;
+        r->next_fd = fd;
+        r->next_offset = 0;
+        r->next_size = st.st_size;
+
+        if (st.st_size == 0)
+        {
+            file_close(r, file);
+
+            if (r->fn(r->user, file, "", 0, true) != 0)
+                return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * file_submit()
+ * ----------------------
+ * Description:
+ *      Starts reads into every free slot while bytes remain.
+ */
+static int file_submit(File_Reader *r)
+{
+    for (int i = 0; i < r->depth && !r->failed; ++i)
+    {
+        File_Slot *slot = &r->slots[i];
+
+        if (slot->state != SLOT_FREE)
+            continue;
+
+        if (file_advance(r) != 0)
+            return -1;
+
+        if (r->next_file >= r->count)
+            break;
+
+        off_t left = r->next_size - r->next_offset;
+
+        slot->file = r->next_file;
+        slot->fd = r->next_fd;
+        slot->offset = r->next_offset;
+        slot->want = left < (off_t)r->chunk ? (size_t)left : r->chunk;
+        slot->got = 0;
+        slot->error = 0;
+        r->next_offset += (off_t)slot->want;
+        r->in_flight++;
+
+#ifdef FILE_HAVE_URING
+        if (r->use_uring)
+        {
+            slot->state = SLOT_RUNNING;
+            file_uring_queue(r, i);
+            continue;
+        }
+#endif
+
+        slot->state = SLOT_RUNNING;
+
+        pthread_mutex_lock(&r->lock);
+        r->queue[(r->queue_head + r->queued) % r->depth] = i;
+        r->queued++;
+        pthread_cond_signal(&r->work);
+        pthread_mutex_unlock(&r->lock);
+    }
+
+    return 0;
+}
+
+/*
+ * file_deliver()
+ * ----------------------
+ * Description:
+ *      Hands every ready chunk that is next in its file to the
+ *      callback, in file order.
+ */
+static int file_deliver(File_Reader *r)
+{
+    bool progress = true;
+
+    while (progress)
+    {
+        progress = false;
+
+        for (int i = 0; i < r->depth; ++i)
+        {
+            File_Slot *slot = &r->slots[i];
+
+            if (slot->state != SLOT_READY || slot->offset != r->delivered[slot->file])
+                continue;
+
+            slot->state = SLOT_FREE;
+            r->in_flight--;
+
+            if (slot->error != 0)
+            {
+                print_log("[ERROR]", RED, "Cannot read \"%s\": %s\n", r->paths[slot->file], strerror(slot->error));
+                return -1;
+            }
+
+            r->delivered[slot->file] += (off_t)slot->want;
+            bool last = r->delivered[slot->file] == r->sizes[slot->file];
+
+            if (last)
+                file_close(r, slot->file);
+
+            if (r->fn(r->user, slot->file, slot->buf, slot->want, last) != 0)
+                return -1;
+
+            progress = true;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * file_read_chunks()
+ * ----------------------
+ * Description:
+ *      Reads files with several reads in flight and passes the
+ *      chunks to fn in order.
+ */
+int file_read_chunks(const char *const *paths, int count, const File_Options *opts, File_Chunk_Fn fn, void *user)
+{
+    File_Options defaults = { 0 };
+    File_Reader r;
+
+    if (opts == NULL)
+        opts = &defaults;
+
+    if (paths == NULL || count < 0 || fn == NULL || opts->depth < 0 || opts->threads < 0)
+    {
+        print_log("[ERROR]", RED, "Invalid file read arguments\n");
+        return -1;
+    }
+
+    if (count == 0)
+        return 0;
+
+    memset(&r, 0, sizeof(r));
+    r.paths = paths;
+    r.count = count;
+    r.fn = fn;
+    r.user = user;
+    r.chunk = opts->chunk_size > 0 ? opts->chunk_size : FILE_CHUNK_SIZE;
+    r.depth = opts->depth > 0 ? opts->depth : FILE_QUEUE_DEPTH;
+    r.next_file = -1;
+
+    /* Round chunks up to a page so registered buffers stay aligned. */
+    r.chunk = (r.chunk + 4095) & ~(size_t)4095;
+
+    r.slots = calloc((size_t)r.depth, sizeof(File_Slot));
+    r.buffers = aligned_alloc(4096, (size_t)r.depth * r.chunk);
+    r.fds = malloc((size_t)count * sizeof(int));
+    r.sizes = calloc((size_t)count, sizeof(off_t));
+    r.delivered = calloc((size_t)count, sizeof(off_t));
+
+    if (r.slots == NULL || r.buffers == NULL || r.fds == NULL || r.sizes == NULL || r.delivered == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for file reader\n");
+        free(r.slots);
+        free(r.buffers);
+        free(r.fds);
+        free(r.sizes);
+        free(r.delivered);
+        return -1;
+    }
+
+    for (int i = 0; i < r.depth; ++i)
+        r.slots[i].buf = r.buffers + (size_t)i * r.chunk;
+
+    for (int i = 0; i < count; ++i)
+        r.fds[i] = -1;
+
+    int status = 0;
+
+#ifdef FILE_HAVE_URING
+    if (opts->backend != FILE_BACKEND_PREAD)
+        r.use_uring = file_uring_init(&r) == 0;
+#endif
+
+    if (!r.use_uring && opts->backend == FILE_BACKEND_URING)
+    {
+        print_log("[ERROR]", RED, "io_uring is not available\n");
+        status = -1;
+    }
+    else if (!r.use_uring)
+    {
+        int threads = opts->threads > 0 && opts->threads < r.depth ? opts->threads : r.depth;
+
+        if (file_pool_init(&r, threads) != 0)
+        {
+            print_log("[ERROR]", RED, "Cannot start file reader threads\n");
+            r.failed = true;
+            status = -1;
+        }
+    }
+
+    if (status == 0)
+    {
+        status = file_submit(&r);
+
+        while (status == 0 && r.in_flight > 0)
+        {
+#ifdef FILE_HAVE_URING
+            if (r.use_uring)
+                status = file_uring_wait(&r);
+            else
+#endif
+                status = file_pool_wait(&r);
+
+            if (status == 0)
+                status = file_deliver(&r);
+            if (status == 0)
+                status = file_submit(&r);
+        }
+
+        /* Buffers may not be freed while the kernel or a thread writes to them. */
+        r.failed = status != 0;
+
+        while (r.failed)
+        {
+            for (int i = 0; i < r.depth; ++i)
+            {
+                if (r.slots[i].state == SLOT_READY)
+                {
+                    r.slots[i].state = SLOT_FREE;
+                    r.in_flight--;
+                }
+            }
+
+            if (r.in_flight == 0)
+                break;
+
+#ifdef FILE_HAVE_URING
+            if (r.use_uring)
+            {
+                if (file_uring_wait(&r) != 0)
+                    break;
+                continue;
+            }
+#endif
+            file_pool_wait(&r);
+        }
+    }
+
+#ifdef FILE_HAVE_URING
+    if (r.use_uring)
+        file_uring_free(&r);
+    else
+#endif
+    if (r.workers != NULL || r.queue != NULL || r.finished != NULL)
+        file_pool_free(&r);
+
+    for (int i = 0; i < count; ++i)
+        file_close(&r, i);
+
+    free(r.slots);
+    free(r.buffers);
+    free(r.fds);
+    free(r.sizes);
+    free(r.delivered);
+    return status;
+}
+
+/* [ Number Parsing ] */
+
+/*
+ * file_separator()
+ * ----------------------
+ * Description:
+ *      Characters that end a number.
+ */
+static inline bool file_separator(char c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == ',' || c == '\v' || c == '\f';
+}
+
+/*
+ * FILE_PARSE_DEFINE()
+ * ----------------------
+ * Description:
+ *      Generates file_token_<type>(), which converts one token, and
+ *      file_parse_<type>(), which splits a chunk into tokens. Integers are
+ *      parsed with strtoll() so long long keeps every digit, and must also
+ *      fit the element type.
+ */
+#define FILE_PARSE_DEFINE(suffix, T, IS_INT, LO, HI)                            \
+static bool file_token_##suffix(const char *token, double min, double max, T *out) \
+{                                                                               \
+    char *end;                                                                  \
+    errno = 0;                                                                  \
+                                                                                \
+    if (IS_INT)                                                                 \
+    {                                                                           \
+        long long value = strtoll(token, &end, 10);                             \
+                                                                                \
+        if (errno != 0 || *end != '\0' || end == token || value < (LO) || value > (HI) \
+            || (double)value < min || (double)value > max)                      \
+            return false;                                                       \
+                                                                                \
+        *out = (T)value;                                                        \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        double value = strtod(token, &end);                                     \
+                                                                                \
+        if (errno != 0 || *end != '\0' || end == token || !(value >= min && value <= max)) \
+            return false;                                                       \
+                                                                                \
+        *out = (T)value;                                                        \
+    }                                                                           \
+                                                                                \
+    return true;                                                                \
+}                                                                               \
+                                                                                \
+static int file_parse_##suffix(File_Fetch *f, int file, const char *data, size_t len, bool last) \
+{                                                                               \
+    File_Parse *p = &f->files[file];                                            \
+    T *arr = p->arr;                                                            \
+    size_t i = 0;                                                               \
+                                                                                \
+    while (i < len || (last && p->carry_len > 0))                               \
+    {                                                                           \
+        while (i < len && p->carry_len == 0 && file_separator(data[i]))         \
+            i++;                                                                \
+                                                                                \
+        size_t start = i;                                                       \
+        while (i < len && !file_separator(data[i]))                             \
+            i++;                                                                \
+                                                                                \
+        size_t n = i - start;                                                   \
+                                                                                \
+        if (p->carry_len + n > FILE_TOKEN_MAX)                                  \
+        {                                                                       \
+            print_log("[ERROR]", RED, "\"%s\": value [ %d ] is too long\n", f->paths[file], p->count + 1); \
+            return -1;                                                          \
+        }                                                                       \
+                                                                                \
+        memcpy(p->carry + p->carry_len, data + start, n);                       \
+        p->carry_len += (int)n;                                                 \
+                                                                                \
+        /* The token may go on in the next chunk. */                            \
+        if (i == len && !last)                                                  \
+            return 0;                                                           \
+                                                                                \
+        if (p->carry_len == 0)                                                  \
+            continue;                                                           \
+                                                                                \
+        p->carry[p->carry_len] = '\0';                                          \
+        p->carry_len = 0;                                                       \
+                                                                                \
+        if (p->count == p->len)                                                 \
+        {                                                                       \
+            print_log("[ERROR]", RED, "\"%s\" holds more than [ %d ] values\n", f->paths[file], p->len); \
+            return -1;                                                          \
+        }                                                                       \
+                                                                                \
+        if (!file_token_##suffix(p->carry, f->min, f->max, &arr[p->count]))     \
+        {                                                                       \
+            print_log("[ERROR]", RED, "\"%s\": value [ %d ] \"%s\" is invalid or outside [ %.1lf ] => [ %.1lf ]\n", \
+                      f->paths[file], p->count + 1, p->carry, f->min, f->max);  \
+            return -1;                                                          \
+        }                                                                       \
+                                                                                \
+        p->count++;                                                             \
+    }                                                                           \
+                                                                                \
+    return 0;                                                                   \
+}
+
+FILE_PARSE_DEFINE(int, int, true, INT_MIN, INT_MAX)
+FILE_PARSE_DEFINE(long, long, true, LONG_MIN, LONG_MAX)
+FILE_PARSE_DEFINE(long_long, long long, true, LLONG_MIN, LLONG_MAX)
+FILE_PARSE_DEFINE(float, float, false, 0, 0)
+FILE_PARSE_DEFINE(double, double, false, 0, 0)
+
+/*
+ * file_parse()
+ * ----------------------
+ * Description:
+ *      Chunk callback of file_fetch_arrays(), switching once per
+ *      chunk on the type.
+ */
+static int file_parse(void *user, int file, const char *data, size_t len, bool last)
+{
+    File_Fetch *f = user;
+
+    switch (f->type)
+    {
+        case TYPE_INT:          return file_parse_int(f, file, data, len, last);
+        case TYPE_LONG:         return file_parse_long(f, file, data, len, last);
+        case TYPE_LONG_LONG:    return file_parse_long_long(f, file, data, len, last);
+        case TYPE_FLOAT:        return file_parse_float(f, file, data, len, last);
+        case TYPE_DOUBLE:       return file_parse_double(f, file, data, len, last);
+        default:                return -1;
+    }
+}
+
+/* [ Functions ] */
+
+/*
+ * file_fetch_arrays()
+ * ----------------------
+ * Description:
+ *      Loads one array of numbers per file, parsing chunks
+ *      while further reads are in flight.
+ */
+int file_fetch_arrays(const char *const *paths, int count, void **arrays, const int *lens, int *counts,
+                      Fetch_Type type, double min, double max, const File_Options *opts)
+{
+    if (paths == NULL || arrays == NULL || lens == NULL || counts == NULL || count < 0 || (unsigned)type > TYPE_DOUBLE)
+    {
+        print_log("[ERROR]", RED, "Invalid file fetch arguments\n");
+        return -1;
+    }
+
+    File_Fetch f = { .paths = paths, .type = type, .min = min, .max = max };
+
+    f.files = calloc(count > 0 ? (size_t)count : 1, sizeof(File_Parse));
+    if (f.files == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for file parser\n");
+        return -1;
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        f.files[i].arr = arrays[i];
+        f.files[i].len = lens[i];
+    }
+
+    int status = file_read_chunks(paths, count, opts, file_parse, &f);
+
+    for (int i = 0; i < count; ++i)
+        counts[i] = f.files[i].count;
+
+    free(f.files);
+    return status;
+}
+
+/*
+ * file_fetch_array()
+ * ----------------------
+ * Description:
+ *      Loads the numbers of a single file.
+ */
+int file_fetch_array(const char *path, void *arr, int len, Fetch_Type type, double min, double max, const File_Options *opts)
+{
+    int count = 0;
+
+    if (file_fetch_arrays(&path, 1, &arr, &len, &count, type, min, max, opts) != 0)
+        return -1;
+
+    return count;
+}
+
+/* file_utils.c */
@@ -0,0 +1,570 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : hash_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at counting and grouping values with a hash table.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <hash_utils.h>
+#include <math.h>
+
+/* [ Macros ] */
+
+#define HASH_PRESIZE_MAX (1 << 20)  // most keys the one-shot helpers size their table for up front
+
+#ifdef __GNUC__
+#define HASH_PREFETCH(ptr) __builtin_prefetch(ptr)
+#else
+#define HASH_PREFETCH(ptr) ((void)(ptr))
+#endif
+
+/* [ Helpers ] */
+
+/*
+ * hash_presize()
+ * ----------------------
+ * Description:
+ *      Sizes a one-shot table from the number of input keys, an upper
+ *      bound on the distinct ones, so it is allocated once instead of
+ *      doubling its way up. Capped so that a long column of few keys
+ *      does not get a huge, cache-missing table.
+ */
+static inline int hash_presize(int len)
+{
+    return len < HASH_PRESIZE_MAX ? len : HASH_PRESIZE_MAX;
+}
+
+/*
+ * Key normalization and bits: 0.0 and -0.0 become one key, so do all
+ * NaNs, after which keys are equal exactly when their bits are.
+ */
+static inline int hash_norm_int(int x) { return x; }
+static inline long hash_norm_long(long x) { return x; }
+static inline long long hash_norm_long_long(long long x) { return x; }
+static inline float hash_norm_float(float x) { return x == 0.0f ? 0.0f : isnan(x) ? NAN : x; }
+static inline double hash_norm_double(double x) { return x == 0.0 ? 0.0 : isnan(x) ? (double)NAN : x; }
+
+static inline uint64_t hash_bits_int(int x) { return (uint64_t)(unsigned int)x; }
+static inline uint64_t hash_bits_long(long x) { return (uint64_t)(unsigned long)x; }
+static inline uint64_t hash_bits_long_long(long long x) { return (uint64_t)x; }
+
+static inline uint64_t hash_bits_float(float x)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+static inline uint64_t hash_bits_double(double x)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+/*
+ * hash_tag()
+ * ----------------------
+ * Description:
+ *      The tag of an occupied slot: the top 7 bits of the hash with
+ *      the high bit set, so it is never 0.
+ */
+static inline uint8_t hash_tag(uint64_t h)
+{
+    return (uint8_t)(0x80 | (h >> 57));
+}
+
+/*
+ * HASH_DEFINE()
+ * ----------------------
+ * Description:
+ *      Generates the probing kernels of one key type. Keys are stored
+ *      normalized, so comparing their bits compares their values.
+ */
+#define HASH_DEFINE(suffix, T)                                                  \
+static size_t hash_insert_##suffix(Hash_Table *table, T key, uint64_t bits, uint64_t h) \
+{                                                                               \
+    T *keys = table->keys;                                                      \
+    size_t mask = table->capacity - 1;                                          \
+    uint8_t tag = hash_tag(h);                                                  \
+                                                                                \
+    for (size_t i = h & mask;; i = (i + 1) & mask)                              \
+    {                                                                           \
+        uint8_t seen = table->tags[i];                                          \
+                                                                                \
+        if (seen == tag && hash_bits_##suffix(keys[i]) == bits)                 \
+            return i;                                                           \
+                                                                                \
+        if (seen == 0)                                                          \
+        {                                                                       \
+            table->tags[i] = tag;                                               \
+            keys[i] = key;                                                      \
+            table->counts[i] = 0;                                               \
+            if (table->sums != NULL)                                            \
+                table->sums[i] = 0.0;                                           \
+            table->count++;                                                     \
+            return i;                                                           \
+        }                                                                       \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static void hash_batch_##suffix(Hash_Table *table, const T *arr, int n, const double *values) \
+{                                                                               \
+    T key[HASH_BATCH];                                                          \
+    uint64_t bits[HASH_BATCH], h[HASH_BATCH];                                   \
+    size_t mask = table->capacity - 1;                                          \
+                                                                                \
+    /* Hash the whole batch first, so its cache misses overlap. */              \
+    for (int i = 0; i < n; ++i)                                                 \
+    {                                                                           \
+        key[i] = hash_norm_##suffix(arr[i]);                                    \
+        bits[i] = hash_bits_##suffix(key[i]);                                   \
+        h[i] = hash_mix64(bits[i]);                                             \
+        HASH_PREFETCH(&table->tags[h[i] & mask]);                               \
+        HASH_PREFETCH((T *)table->keys + (h[i] & mask));                        \
+    }                                                                           \
+                                                                                \
+    for (int i = 0; i < n; ++i)                                                 \
+    {                                                                           \
+        size_t slot = hash_insert_##suffix(table, key[i], bits[i], h[i]);       \
+                                                                                \
+        table->counts[slot]++;                                                  \
+        if (values != NULL)                                                     \
+            table->sums[slot] += values[i];                                     \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static long long hash_find_##suffix(const Hash_Table *table, T key)             \
+{                                                                               \
+    const T *keys = table->keys;                                                \
+    uint64_t bits = hash_bits_##suffix(hash_norm_##suffix(key));                \
+    uint64_t h = hash_mix64(bits);                                              \
+    size_t mask = table->capacity - 1;                                          \
+    uint8_t tag = hash_tag(h);                                                  \
+                                                                                \
+    for (size_t i = h & mask;; i = (i + 1) & mask)                              \
+    {                                                                           \
+        uint8_t seen = table->tags[i];                                          \
+                                                                                \
+        if (seen == tag && hash_bits_##suffix(keys[i]) == bits)                 \
+            return (long long)i;                                                \
+                                                                                \
+        if (seen == 0)                                                          \
+            return -1;                                                          \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+/* Moves every slot of from into the empty table to, whose keys are all new. */ \
+static void hash_move_##suffix(Hash_Table *to, const Hash_Table *from)          \
+{                                                                               \
+    const T *keys = from->keys;                                                 \
+    size_t mask = to->capacity - 1;                                             \
+                                                                                \
+    for (size_t s = 0; s < from->capacity; ++s)                                 \
+    {                                                                           \
+        if (from->tags[s] == 0)                                                 \
+            continue;                                                           \
+                                                                                \
+        uint64_t h = hash_mix64(hash_bits_##suffix(keys[s]));                   \
+        size_t i = h & mask;                                                    \
+                                                                                \
+        while (to->tags[i] != 0)                                                \
+            i = (i + 1) & mask;                                                 \
+                                                                                \
+        to->tags[i] = from->tags[s];                                            \
+        ((T *)to->keys)[i] = keys[s];                                           \
+        to->counts[i] = from->counts[s];                                        \
+        if (to->sums != NULL)                                                   \
+            to->sums[i] = from->sums != NULL ? from->sums[s] : 0.0;             \
+    }                                                                           \
+                                                                                \
+    to->count = from->count;                                                    \
+}
+
+HASH_DEFINE(int, int)
+HASH_DEFINE(long, long)
+HASH_DEFINE(long_long, long long)
+HASH_DEFINE(float, float)
+HASH_DEFINE(double, double)
+
+/*
+ * HASH_DISPATCH()
+ * ----------------------
+ * Description:
+ *      Switches once on the key type and calls the typed kernel.
+ */
+#define HASH_DISPATCH(kernel, type, ...)                                        \
+    switch (type)                                                               \
+    {                                                                           \
+        case TYPE_INT:          kernel##_int(__VA_ARGS__);          break;      \
+        case TYPE_LONG:         kernel##_long(__VA_ARGS__);         break;      \
+        case TYPE_LONG_LONG:    kernel##_long_long(__VA_ARGS__);    break;      \
+        case TYPE_FLOAT:        kernel##_float(__VA_ARGS__);        break;      \
+        case TYPE_DOUBLE:       kernel##_double(__VA_ARGS__);       break;      \
+        default:                break;                                          \
+    }
+
+/*
+ * hash_release()
+ * ----------------------
+ * Description:
+ *      Frees the arrays of a table through its allocator.
+ */
+static void hash_release(Hash_Table *table)
+{
+    const Utils_Allocator *allocator = &table->allocator;
+
+    allocator->free(allocator->user, table->tags);
+    allocator->free(allocator->user, table->keys);
+    allocator->free(allocator->user, table->counts);
+    allocator->free(allocator->user, table->sums);
+    table->tags = NULL;
+    table->keys = NULL;
+    table->counts = NULL;
+    table->sums = NULL;
+}
+
+/*
+ * hash_alloc()
+ * ----------------------
+ * Description:
+ *      Allocates empty arrays of the given capacity, with sums if
+ *      asked to.
+ */
+static int hash_alloc(Hash_Table *table, size_t capacity, bool sums)
+{
+    const Utils_Allocator *allocator = &table->allocator;
+
+    table->capacity = capacity;
+    table->count = 0;
+    table->tags = allocator->alloc(allocator->user, capacity);
+    table->keys = allocator->alloc(allocator->user, capacity * type_sizes[table->type]);
+    table->counts = allocator->alloc(allocator->user, capacity * sizeof(long long));
+    table->sums = sums ? allocator->alloc(allocator->user, capacity * sizeof(double)) : NULL;
+
+    if (table->tags == NULL || table->keys == NULL || table->counts == NULL || (sums && table->sums == NULL))
+    {
+        hash_release(table);
+        return -1;
+    }
+
+    memset(table->tags, 0, capacity);
+    return 0;
+}
+
+/*
+ * hash_reserve()
+ * ----------------------
+ * Description:
+ *      Grows the table until more keys fit under the 3/4 load
+ *      factor, and allocates the sums if needed.
+ */
+static int hash_reserve(Hash_Table *table, int more, bool sums)
+{
+    size_t need = (size_t)table->count + (size_t)more;
+    size_t capacity = table->capacity;
+
+    while (need > capacity / 4 * 3)
+        capacity *= 2;
+
+    if (capacity == table->capacity)
+    {
+        if (sums && table->sums == NULL)
+        {
+            table->sums = table->allocator.alloc(table->allocator.user, capacity * sizeof(double));
+            if (table->sums == NULL)
+                return -1;
+
+            memset(table->sums, 0, capacity * sizeof(double));
+        }
+
+        return 0;
+    }
+
+    Hash_Table grown = *table;
+
+    if (hash_alloc(&grown, capacity, sums || table->sums != NULL) != 0)
+        return -1;
+
+    /* Keys added without sums so far move over with a sum of 0. */
+    HASH_DISPATCH(hash_move, table->type, &grown, table);
+
+    hash_release(table);
+    *table = grown;
+    return 0;
+}
+
+/*
+ * hash_values()
+ * ----------------------
+ * Description:
+ *      Widens n values starting at start to double.
+ */
+static void hash_values(const void *values, int start, int n, Fetch_Type type, double *out)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        switch (type)
+        {
+            case TYPE_INT:          out[i] = ((const int *)values)[start + i];                  break;
+            case TYPE_LONG:         out[i] = (double)((const long *)values)[start + i];         break;
+            case TYPE_LONG_LONG:    out[i] = (double)((const long long *)values)[start + i];    break;
+            case TYPE_FLOAT:        out[i] = ((const float *)values)[start + i];                break;
+            case TYPE_DOUBLE:       out[i] = ((const double *)values)[start + i];               break;
+            default:                out[i] = 0.0;                                               break;
+        }
+    }
+}
+
+/*
+ * hash_insert()
+ * ----------------------
+ * Description:
+ *      Adds keys, and optionally values, one batch at a time.
+ */
+static int hash_insert(Hash_Table *table, const void *keys, const void *values, int len, Fetch_Type value_type)
+{
+    if (table == NULL || table->tags == NULL || len < 0 || (keys == NULL && len > 0) ||
+        (values != NULL && (unsigned)value_type > TYPE_DOUBLE))
+        return -1;
+
+    size_t size = type_sizes[table->type];
+    double sums[HASH_BATCH];
+
+    for (int i = 0; i < len; i += HASH_BATCH)
+    {
+        int n = len - i < HASH_BATCH ? len - i : HASH_BATCH;
+        const void *batch = (const char *)keys + (size_t)i * size;
+
+        if (hash_reserve(table, n, values != NULL) != 0)
+        {
+            print_log("[ERROR]", RED, "Memory allocation failed for hash table of [ %d ] keys\n", table->count);
+            return -1;
+        }
+
+        if (values != NULL)
+            hash_values(values, i, n, value_type, sums);
+
+        HASH_DISPATCH(hash_batch, table->type, table, batch, n, values != NULL ? sums : NULL);
+    }
+
+    return 0;
+}
+
+/* [ Functions ] */
+
+/*
+ * hash_init()
+ * ----------------------
+ * Description:
+ *      Creates an empty table.
+ */
+int hash_init(Hash_Table *table, Fetch_Type type, int expected, const Utils_Allocator *allocator)
+{
+    if (table == NULL || (unsigned)type > TYPE_DOUBLE || expected < 0)
+        return -1;
+
+    size_t capacity = HASH_MIN_CAPACITY;
+
+    while ((size_t)expected > capacity / 4 * 3)
+        capacity *= 2;
+
+    table->type = type;
+    table->allocator = allocator != NULL ? *allocator : context_default()->allocator;
+
+    if (hash_alloc(table, capacity, false) != 0)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for hash table\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * hash_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a table.
+ */
+void hash_free(Hash_Table *table)
+{
+    if (table == NULL)
+        return;
+
+    hash_release(table);
+    table->capacity = 0;
+    table->count = 0;
+}
+
+/*
+ * hash_add()
+ * ----------------------
+ * Description:
+ *      Counts every key of an array.
+ */
+int hash_add(Hash_Table *table, const void *keys, int len)
+{
+    return hash_insert(table, keys, NULL, len, TYPE_INT);
+}
+
+/*
+ * hash_add_sums()
+ * ----------------------
+ * Description:
+ *      Counts every key and sums its values.
+ */
+int hash_add_sums(Hash_Table *table, const void *keys, const void *values, int len, Fetch_Type value_type)
+{
+    if (values == NULL && len > 0)
+        return -1;
+
+    return hash_insert(table, keys, values, len, value_type);
+}
+
+/*
+ * hash_find()
+ * ----------------------
+ * Description:
+ *      Looks a key up.
+ */
+long long hash_find(const Hash_Table *table, const void *key)
+{
+    if (table == NULL || table->tags == NULL || key == NULL)
+        return -1;
+
+    switch (table->type)
+    {
+        case TYPE_INT:          return hash_find_int(table, *(const int *)key);
+        case TYPE_LONG:         return hash_find_long(table, *(const long *)key);
+        case TYPE_LONG_LONG:    return hash_find_long_long(table, *(const long long *)key);
+        case TYPE_FLOAT:        return hash_find_float(table, *(const float *)key);
+        case TYPE_DOUBLE:       return hash_find_double(table, *(const double *)key);
+        default:                return -1;
+    }
+}
+
+/*
+ * hash_items()
+ * ----------------------
+ * Description:
+ *      Copies the distinct keys out with their counts and sums.
+ */
+int hash_items(const Hash_Table *table, void *keys, long long *counts, double *sums)
+{
+    if (table == NULL || table->tags == NULL)
+        return -1;
+
+    size_t size = type_sizes[table->type];
+    int k = 0;
+
+    for (size_t i = 0; i < table->capacity; ++i)
+    {
+        if (table->tags[i] == 0)
+            continue;
+
+        if (keys != NULL)
+            memcpy((char *)keys + (size_t)k * size, (const char *)table->keys + i * size, size);
+        if (counts != NULL)
+            counts[k] = table->counts[i];
+        if (sums != NULL)
+            sums[k] = table->sums != NULL ? table->sums[i] : 0.0;
+
+        k++;
+    }
+
+    return k;
+}
+
+/*
+ * hash_count_distinct()
+ * ----------------------
+ * Description:
+ *      Counts the distinct values of an array.
+ */
+int hash_count_distinct(const void *arr, int len, Fetch_Type type)
+{
+    Hash_Table table;
+
+    if (hash_init(&table, type, hash_presize(len), NULL) != 0)
+        return -1;
+
+    int count = hash_add(&table, arr, len) == 0 ? table.count : -1;
+
+    hash_free(&table);
+    return count;
+}
+
+/*
+ * hash_frequencies()
+ * ----------------------
+ * Description:
+ *      Lists the distinct values of an array with their counts.
+ */
+int hash_frequencies(const void *arr, int len, Fetch_Type type, void *keys, int *counts)
+{
+    Hash_Table table;
+
+    if ((keys == NULL || counts == NULL) && len > 0)
+        return -1;
+
+    if (hash_init(&table, type, hash_presize(len), NULL) != 0)
+        return -1;
+
+    if (hash_add(&table, arr, len) != 0)
+    {
+        hash_free(&table);
+        return -1;
+    }
+
+    size_t size = type_sizes[type];
+    int k = 0;
+
+    for (size_t i = 0; i < table.capacity; ++i)
+    {
+        if (table.tags[i] == 0)
+            continue;
+
+        memcpy((char *)keys + (size_t)k * size, (const char *)table.keys + i * size, size);
+        counts[k++] = (int)table.counts[i];
+    }
+
+    hash_free(&table);
+    return k;
+}
+
+/*
+ * hash_group_sum()
+ * ----------------------
+ * Description:
+ *      Sums values grouped by key.
+ */
+int hash_group_sum(const void *keys, const void *values, int len, Fetch_Type key_type, Fetch_Type value_type,
+                   void *out_keys, double *out_sums)
+{
+    Hash_Table table;
+
+    if ((out_keys == NULL || out_sums == NULL) && len > 0)
+        return -1;
+
+    if (hash_init(&table, key_type, hash_presize(len), NULL) != 0)
+        return -1;
+
+    int count = hash_add_sums(&table, keys, values, len, value_type) == 0 ? hash_items(&table, out_keys, NULL, out_sums) : -1;
+
+    hash_free(&table);
+    return count;
+}
+
+/* hash_utils.c */
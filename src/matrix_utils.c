@@ -0,0 +1,557 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : matrix_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at contiguous matrices.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <matrix_utils.h>
+#include <cpu_utils.h>
+#include <sort_template.h>
+#include <stdint.h>
+
+#ifdef UTILS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/* [ Macros ] */
+
+#define MATRIX_REDUCE_BLOCK (512)   // columns reduced together, so their accumulators stay in L1
+
+/* [ Structs ] */
+
+/* One transpose: a sub-block of a source and where its transpose goes. */
+typedef struct
+{
+    char *dst;          // first element of the destination block
+    const char *src;    // first element of the source block
+    size_t dst_stride;  // elements between two destination rows
+    size_t src_stride;  // elements between two source rows
+    size_t size;        // size of one element, 4 or 8
+    bool simd;          // whether the AVX2 tiles may be used
+} Matrix_Transpose;
+
+/* [ Helpers ] */
+
+/*
+ * matrix_valid()
+ * ----------------------
+ * Description:
+ *      Checks a matrix before it is read.
+ */
+static inline bool matrix_valid(const Utils_Matrix *matrix)
+{
+    return matrix != NULL && matrix->data != NULL && matrix->rows > 0 && matrix->cols > 0 &&
+           (unsigned)matrix->type <= TYPE_DOUBLE;
+}
+
+/* [ Kernels ] */
+
+/*
+ * matrix_tile_scalar()
+ * ----------------------
+ * Description:
+ *      Transposes a rows x cols block element by element,
+ *      for the ragged edges and CPUs without AVX2.
+ */
+static void matrix_tile_scalar(const Matrix_Transpose *t, size_t r0, size_t c0, int rows, int cols)
+{
+    if (t->size == 4)
+    {
+        const uint32_t *src = (const uint32_t *)t->src + r0 * t->src_stride + c0;
+        uint32_t *dst = (uint32_t *)t->dst + c0 * t->dst_stride + r0;
+
+        for (int j = 0; j < cols; ++j)
+            for (int i = 0; i < rows; ++i)
+                dst[j * t->dst_stride + i] = src[i * t->src_stride + j];
+    }
+    else
+    {
+        const uint64_t *src = (const uint64_t *)t->src + r0 * t->src_stride + c0;
+        uint64_t *dst = (uint64_t *)t->dst + c0 * t->dst_stride + r0;
+
+        for (int j = 0; j < cols; ++j)
+            for (int i = 0; i < rows; ++i)
+                dst[j * t->dst_stride + i] = src[i * t->src_stride + j];
+    }
+}
+
+#ifdef UTILS_X86_SIMD
+
+/*
+ * matrix_tile_8x8_avx2()
+ * ----------------------
+ * Description:
+ *      Transposes an 8x8 tile of 32-bit elements in registers:
+ *      interleave pairs of rows, then pairs of pairs, then swap
+ *      the 128-bit halves.
+ */
+__attribute__((target("avx2")))
+static void matrix_tile_8x8_avx2(uint32_t *dst, size_t ds, const uint32_t *src, size_t ss)
+{
+    __m256i r0 = _mm256_loadu_si256((const __m256i *)(src + 0 * ss));
+    __m256i r1 = _mm256_loadu_si256((const __m256i *)(src + 1 * ss));
+    __m256i r2 = _mm256_loadu_si256((const __m256i *)(src + 2 * ss));
+    __m256i r3 = _mm256_loadu_si256((const __m256i *)(src + 3 * ss));
+    __m256i r4 = _mm256_loadu_si256((const __m256i *)(src + 4 * ss));
+    __m256i r5 = _mm256_loadu_si256((const __m256i *)(src + 5 * ss));
+    __m256i r6 = _mm256_loadu_si256((const __m256i *)(src + 6 * ss));
+    __m256i r7 = _mm256_loadu_si256((const __m256i *)(src + 7 * ss));
+
+    /* a0 b0 a1 b1 | a4 b4 a5 b5 and a2 b2 a3 b3 | a6 b6 a7 b7 */
+    __m256i t0 = _mm256_unpacklo_epi32(r0, r1);
+    __m256i t1 = _mm256_unpackhi_epi32(r0, r1);
+    __m256i t2 = _mm256_unpacklo_epi32(r2, r3);
+    __m256i t3 = _mm256_unpackhi_epi32(r2, r3);
+    __m256i t4 = _mm256_unpacklo_epi32(r4, r5);
+    __m256i t5 = _mm256_unpackhi_epi32(r4, r5);
+    __m256i t6 = _mm256_unpacklo_epi32(r6, r7);
+    __m256i t7 = _mm256_unpackhi_epi32(r6, r7);
+
+    /* a0 b0 c0 d0 | a4 b4 c4 d4, and so on for columns 1 to 3 */
+    __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+    _mm256_storeu_si256((__m256i *)(dst + 0 * ds), _mm256_permute2x128_si256(u0, u4, 0x20));
+    _mm256_storeu_si256((__m256i *)(dst + 1 * ds), _mm256_permute2x128_si256(u1, u5, 0x20));
+    _mm256_storeu_si256((__m256i *)(dst + 2 * ds), _mm256_permute2x128_si256(u2, u6, 0x20));
+    _mm256_storeu_si256((__m256i *)(dst + 3 * ds), _mm256_permute2x128_si256(u3, u7, 0x20));
+    _mm256_storeu_si256((__m256i *)(dst + 4 * ds), _mm256_permute2x128_si256(u0, u4, 0x31));
+    _mm256_storeu_si256((__m256i *)(dst + 5 * ds), _mm256_permute2x128_si256(u1, u5, 0x31));
+    _mm256_storeu_si256((__m256i *)(dst + 6 * ds), _mm256_permute2x128_si256(u2, u6, 0x31));
+    _mm256_storeu_si256((__m256i *)(dst + 7 * ds), _mm256_permute2x128_si256(u3, u7, 0x31));
+}
+
+/*
+ * matrix_tile_4x4_avx2()
+ * ----------------------
+ * Description:
+ *      Transposes a 4x4 tile of 64-bit elements in registers.
+ */
+__attribute__((target("avx2")))
+static void matrix_tile_4x4_avx2(uint64_t *dst, size_t ds, const uint64_t *src, size_t ss)
+{
+    __m256i r0 = _mm256_loadu_si256((const __m256i *)(src + 0 * ss));
+    __m256i r1 = _mm256_loadu_si256((const __m256i *)(src + 1 * ss));
+    __m256i r2 = _mm256_loadu_si256((const __m256i *)(src + 2 * ss));
+    __m256i r3 = _mm256_loadu_si256((const __m256i *)(src + 3 * ss));
+
+    /* a0 b0 | a2 b2 and a1 b1 | a3 b3 */
+    __m256i t0 = _mm256_unpacklo_epi64(r0, r1);
+    __m256i t1 = _mm256_unpackhi_epi64(r0, r1);
+    __m256i t2 = _mm256_unpacklo_epi64(r2, r3);
+    __m256i t3 = _mm256_unpackhi_epi64(r2, r3);
+
+    _mm256_storeu_si256((__m256i *)(dst + 0 * ds), _mm256_permute2x128_si256(t0, t2, 0x20));
+    _mm256_storeu_si256((__m256i *)(dst + 1 * ds), _mm256_permute2x128_si256(t1, t3, 0x20));
+    _mm256_storeu_si256((__m256i *)(dst + 2 * ds), _mm256_permute2x128_si256(t0, t2, 0x31));
+    _mm256_storeu_si256((__m256i *)(dst + 3 * ds), _mm256_permute2x128_si256(t1, t3, 0x31));
+}
+
+/*
+ * matrix_leaf_avx2()
+ * ----------------------
+ * Description:
+ *      Transposes a leaf block in full tiles, leaving
+ *      the ragged right and bottom edges to the scalar loop.
+ */
+__attribute__((target("avx2")))
+static void matrix_leaf_avx2(const Matrix_Transpose *t, size_t r0, size_t c0, int rows, int cols)
+{
+    int tile = t->size == 4 ? 8 : 4;
+    int full_rows = rows - rows % tile;
+    int full_cols = cols - cols % tile;
+
+    for (int i = 0; i < full_rows; i += tile)
+    {
+        for (int j = 0; j < full_cols; j += tile)
+        {
+            size_t r = r0 + (size_t)i, c = c0 + (size_t)j;
+
+            if (t->size == 4)
+                matrix_tile_8x8_avx2((uint32_t *)t->dst + c * t->dst_stride + r, t->dst_stride,
+                                     (const uint32_t *)t->src + r * t->src_stride + c, t->src_stride);
+            else
+                matrix_tile_4x4_avx2((uint64_t *)t->dst + c * t->dst_stride + r, t->dst_stride,
+                                     (const uint64_t *)t->src + r * t->src_stride + c, t->src_stride);
+        }
+    }
+
+    if (full_cols < cols)
+        matrix_tile_scalar(t, r0, c0 + (size_t)full_cols, full_rows, cols - full_cols);
+
+    if (full_rows < rows)
+        matrix_tile_scalar(t, r0 + (size_t)full_rows, c0, rows - full_rows, cols);
+}
+
+#endif
+
+/*
+ * matrix_transpose_block()
+ * ----------------------
+ * Description:
+ *      Halves a block along its longer side until it fits
+ *      a leaf, then transposes the leaf.
+ */
+static void matrix_transpose_block(const Matrix_Transpose *t, size_t r0, size_t c0, int rows, int cols)
+{
+    while (rows > MATRIX_LEAF || cols > MATRIX_LEAF)
+    {
+        /* Split on a multiple of 8 so the halves keep whole tiles. */
+        if (rows >= cols)
+        {
+            int half = (rows / 2 + 7) & ~7;
+
+            matrix_transpose_block(t, r0, c0, half, cols);
+            r0 += (size_t)half;
+            rows -= half;
+        }
+        else
+        {
+            int half = (cols / 2 + 7) & ~7;
+
+            matrix_transpose_block(t, r0, c0, rows, half);
+            c0 += (size_t)half;
+            cols -= half;
+        }
+    }
+
+#ifdef UTILS_X86_SIMD
+    if (t->simd)
+    {
+        matrix_leaf_avx2(t, r0, c0, rows, cols);
+        return;
+    }
+#endif
+
+    matrix_tile_scalar(t, r0, c0, rows, cols);
+}
+
+/*
+ * matrix_transpose_run()
+ * ----------------------
+ * Description:
+ *      Transposes rows x cols elements of type between two
+ *      strided buffers.
+ */
+static void matrix_transpose_run(void *dst, size_t dst_stride, const void *src, size_t src_stride,
+                                 int rows, int cols, Fetch_Type type)
+{
+    Matrix_Transpose t = {
+        .dst = dst,
+        .src = src,
+        .dst_stride = dst_stride,
+        .src_stride = src_stride,
+        .size = type_sizes[type],
+        .simd = false,
+    };
+
+#ifdef UTILS_X86_SIMD
+    t.simd = cpu_tier() >= CPU_TIER_AVX2;
+#endif
+
+    matrix_transpose_block(&t, 0, 0, rows, cols);
+}
+
+/*
+ * MATRIX_SORT_DEFINE()
+ * ----------------------
+ * Description:
+ *      Generates the introsort of one type and a loop
+ *      sorting count rows of len elements.
+ */
+#define MATRIX_LESS(a, b) ((a) < (b))
+
+#define MATRIX_SORT_DEFINE(suffix, T)                                           \
+SORT_DEFINE(matrix_##suffix, T, MATRIX_LESS)                                    \
+                                                                                \
+static void matrix_sort_##suffix##_rows(void *data, int count, int len)         \
+{                                                                               \
+    T *row = data;                                                              \
+                                                                                \
+    for (int i = 0; i < count; ++i, row += len)                                 \
+        matrix_##suffix##_sort(row, len);                                       \
+}
+
+MATRIX_SORT_DEFINE(int, int)
+MATRIX_SORT_DEFINE(long, long)
+MATRIX_SORT_DEFINE(long_long, long long)
+MATRIX_SORT_DEFINE(float, float)
+MATRIX_SORT_DEFINE(double, double)
+
+static void (*const matrix_sort_kernels[])(void *, int, int) = {
+    [TYPE_INT] = matrix_sort_int_rows,
+    [TYPE_LONG] = matrix_sort_long_rows,
+    [TYPE_LONG_LONG] = matrix_sort_long_long_rows,
+    [TYPE_FLOAT] = matrix_sort_float_rows,
+    [TYPE_DOUBLE] = matrix_sort_double_rows,
+};
+
+/* [ Functions ] */
+
+/*
+ * matrix_init()
+ * ----------------------
+ * Description:
+ *      Allocates an uninitialized contiguous matrix.
+ */
+int matrix_init(Utils_Matrix *matrix, int rows, int cols, Fetch_Type type)
+{
+    if (matrix == NULL || rows <= 0 || cols <= 0 || (unsigned)type > TYPE_DOUBLE)
+        return -1;
+
+    /* Cache-line aligned, and aligned_alloc() wants a multiple of it. */
+    size_t bytes = ((size_t)rows * (size_t)cols * type_sizes[type] + 63) & ~(size_t)63;
+
+    matrix->data = aligned_alloc(64, bytes);
+    matrix->rows = rows;
+    matrix->cols = cols;
+    matrix->type = type;
+
+    if (matrix->data == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for matrix\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * matrix_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a matrix.
+ */
+void matrix_free(Utils_Matrix *matrix)
+{
+    if (matrix == NULL)
+        return;
+
+    free(matrix->data);
+    matrix->data = NULL;
+    matrix->rows = 0;
+    matrix->cols = 0;
+}
+
+/*
+ * matrix_from_rows()
+ * ----------------------
+ * Description:
+ *      Copies separate rows into a new contiguous matrix.
+ */
+int matrix_from_rows(Utils_Matrix *matrix, void **rows_ptr, int rows, int cols, Fetch_Type type)
+{
+    if (rows_ptr == NULL || matrix_init(matrix, rows, cols, type) != 0)
+        return -1;
+
+    size_t row_bytes = (size_t)cols * type_sizes[type];
+
+    for (int i = 0; i < rows; ++i)
+    {
+        if (rows_ptr[i] == NULL)
+        {
+            matrix_free(matrix);
+            return -1;
+        }
+
+        memcpy((char *)matrix->data + (size_t)i * row_bytes, rows_ptr[i], row_bytes);
+    }
+
+    return 0;
+}
+
+/*
+ * matrix_row_pointers()
+ * ----------------------
+ * Description:
+ *      Points into every row of a matrix.
+ */
+int matrix_row_pointers(const Utils_Matrix *matrix, void **rows_ptr)
+{
+    if (!matrix_valid(matrix) || rows_ptr == NULL)
+        return -1;
+
+    size_t row_bytes = (size_t)matrix->cols * type_sizes[matrix->type];
+
+    for (int i = 0; i < matrix->rows; ++i)
+        rows_ptr[i] = (char *)matrix->data + (size_t)i * row_bytes;
+
+    return 0;
+}
+
+/*
+ * matrix_transpose()
+ * ----------------------
+ * Description:
+ *      Writes the transpose of a matrix into another.
+ */
+int matrix_transpose(Utils_Matrix *dst, const Utils_Matrix *src)
+{
+    if (!matrix_valid(src) || !matrix_valid(dst) || dst->data == src->data)
+        return -1;
+
+    if (dst->type != src->type || dst->rows != src->cols || dst->cols != src->rows)
+    {
+        print_log("[ERROR]", RED, "Transpose of a %dx%d matrix cannot be stored in a %dx%d matrix\n",
+                  src->rows, src->cols, dst->rows, dst->cols);
+        return -1;
+    }
+
+    matrix_transpose_run(dst->data, (size_t)dst->cols, src->data, (size_t)src->cols, src->rows, src->cols, src->type);
+    return 0;
+}
+
+/*
+ * matrix_columns()
+ * ----------------------
+ * Description:
+ *      Copies consecutive columns out as contiguous arrays.
+ */
+int matrix_columns(const Utils_Matrix *matrix, int first, int count, void *out)
+{
+    if (!matrix_valid(matrix) || out == NULL || first < 0 || count <= 0 || count > matrix->cols - first)
+        return -1;
+
+    const char *src = (const char *)matrix->data + (size_t)first * type_sizes[matrix->type];
+
+    matrix_transpose_run(out, (size_t)matrix->rows, src, (size_t)matrix->cols, matrix->rows, count, matrix->type);
+    return 0;
+}
+
+/*
+ * matrix_column()
+ * ----------------------
+ * Description:
+ *      Copies one column out as a contiguous array.
+ */
+int matrix_column(const Utils_Matrix *matrix, int col, void *out)
+{
+    return matrix_columns(matrix, col, 1, out);
+}
+
+/*
+ * matrix_sort_rows()
+ * ----------------------
+ * Description:
+ *      Sorts every row of a matrix in place.
+ */
+int matrix_sort_rows(Utils_Matrix *matrix)
+{
+    if (!matrix_valid(matrix))
+        return -1;
+
+    matrix_sort_kernels[matrix->type](matrix->data, matrix->rows, matrix->cols);
+    return 0;
+}
+
+/*
+ * matrix_sort_cols()
+ * ----------------------
+ * Description:
+ *      Sorts every column of a matrix in place through
+ *      a transposed copy.
+ */
+int matrix_sort_cols(Utils_Matrix *matrix)
+{
+    if (!matrix_valid(matrix))
+        return -1;
+
+    Utils_Matrix scratch;
+
+    if (matrix_init(&scratch, matrix->cols, matrix->rows, matrix->type) != 0)
+        return -1;
+
+    matrix_transpose(&scratch, matrix);
+    matrix_sort_kernels[scratch.type](scratch.data, scratch.rows, scratch.cols);
+    matrix_transpose(matrix, &scratch);
+
+    matrix_free(&scratch);
+    return 0;
+}
+
+/*
+ * matrix_reduce_rows()
+ * ----------------------
+ * Description:
+ *      Applies a reduction to every row of a matrix.
+ */
+int matrix_reduce_rows(const Utils_Matrix *matrix, Stats_Op op, double *out)
+{
+    if (!matrix_valid(matrix) || out == NULL)
+        return -1;
+
+    void **rows = malloc((size_t)matrix->rows * sizeof(void *));
+    if (rows == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for row pointers\n");
+        return -1;
+    }
+
+    matrix_row_pointers(matrix, rows);
+
+    int status = stats_reduce_rows(rows, matrix->rows, matrix->cols, matrix->type, op, out);
+
+    free(rows);
+    return status;
+}
+
+/*
+ * matrix_reduce_cols()
+ * ----------------------
+ * Description:
+ *      Applies a reduction to every column of a matrix,
+ *      MATRIX_REDUCE_BLOCK columns at a time.
+ */
+int matrix_reduce_cols(const Utils_Matrix *matrix, Stats_Op op, double *out)
+{
+    if (!matrix_valid(matrix) || out == NULL)
+        return -1;
+
+    void **rows = malloc((size_t)matrix->rows * sizeof(void *));
+    if (rows == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for row pointers\n");
+        return -1;
+    }
+
+    size_t size = type_sizes[matrix->type];
+    int status = 0;
+
+    matrix_row_pointers(matrix, rows);
+
+    /*
+     * A wide matrix would push the per-column accumulators of
+     * stats_reduce_cols() out of L1, so the columns go through
+     * in blocks, each a strip of every row.
+     */
+    for (int first = 0; first < matrix->cols && status == 0; first += MATRIX_REDUCE_BLOCK)
+    {
+        int count = matrix->cols - first < MATRIX_REDUCE_BLOCK ? matrix->cols - first : MATRIX_REDUCE_BLOCK;
+
+        status = stats_reduce_cols(rows, matrix->rows, count, matrix->type, op, out + first);
+
+        for (int i = 0; i < matrix->rows; ++i)
+            rows[i] = (char *)rows[i] + (size_t)count * size;
+    }
+
+    free(rows);
+    return status;
+}
+
+/* matrix_utils.c */
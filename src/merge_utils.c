@@ -0,0 +1,375 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : merge_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at merging many sorted arrays at once.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <merge_utils.h>
+#include <thread_utils.h>
+#include <limits.h>
+#include <math.h>
+
+/* [ Structs ] */
+
+/* One slice of the output, merged by one thread. */
+typedef struct
+{
+    const Merge_Run *runs;  // the full runs
+    int k;                  // number of runs
+    Fetch_Type type;        // type of the elements
+    long long begin;        // first output index of the slice
+    long long end;          // one past the last output index
+    void *dst;              // where the slice starts in the output
+
+    /* Scratch, private to the slice. */
+    const void **data;      // run heads within the slice
+    int *len;               // run lengths within the slice
+    int *pos;               // read position in every run
+    int *tree;              // loser tree (k) followed by the build buffer (2k)
+    void *keys;             // key of the loser kept at every tree node
+} Merge_Part;
+
+/* [ Kernels ] */
+
+/*
+ * MERGE_DEFINE()
+ * ----------------------
+ * Description:
+ *      Instantiates the loser tree merge and the co-ranking for one type.
+ *      Elements are ordered by value, then by run index, then by position,
+ *      which makes the merge stable and gives every element a unique rank.
+ *      Every tree node caches the key of its loser, so a replay reads
+ *      nothing but the tree, and an exhausted run becomes a MAX sentinel
+ *      that loses every tie thanks to its out-of-range index.
+ */
+#define MERGE_DEFINE(suffix, T, MAX)                                            \
+                                                                                \
+/* Ordered by key, then by run. Exhausted runs hold MAX and index k + run. */   \
+static inline bool merge_less_##suffix(T x, int i, T y, int j)                  \
+{                                                                               \
+    return (x < y) | ((x == y) & (i < j));                                      \
+}                                                                               \
+                                                                                \
+static inline T merge_head_##suffix(const Merge_Part *part, int i)              \
+{                                                                               \
+    return part->pos[i] < part->len[i] ? ((const T *)part->data[i])[part->pos[i]] : MAX; \
+}                                                                               \
+                                                                                \
+static void merge_tree_##suffix(Merge_Part *part)                               \
+{                                                                               \
+    const void **data = part->data;                                             \
+    const int *len = part->len;                                                 \
+    int *pos = part->pos;                                                       \
+    int *tree = part->tree;                                                     \
+    int *win = part->tree + part->k;                                            \
+    T *keys = part->keys;                                                       \
+    int k = part->k;                                                            \
+    T *dst = part->dst;                                                         \
+    long long total = part->end - part->begin;                                  \
+                                                                                \
+    /* Leaves sit at k..2k-1, every inner node keeps the loser of its match. */ \
+    for (int i = 0; i < k; ++i)                                                 \
+    {                                                                           \
+        pos[i] = 0;                                                             \
+        win[k + i] = len[i] > 0 ? i : k + i;                                    \
+    }                                                                           \
+                                                                                \
+    for (int n = k - 1; n >= 1; --n)                                            \
+    {                                                                           \
+        int l = win[2 * n], r = win[2 * n + 1];                                 \
+        T lk = merge_head_##suffix(part, l < k ? l : l - k);                    \
+        T rk = merge_head_##suffix(part, r < k ? r : r - k);                    \
+        bool left = merge_less_##suffix(lk, l, rk, r);                          \
+                                                                                \
+        win[n] = left ? l : r;                                                  \
+        tree[n] = left ? r : l;                                                 \
+        keys[n] = left ? rk : lk;                                               \
+    }                                                                           \
+                                                                                \
+    int w = win[1];                                                             \
+    T key = merge_head_##suffix(part, w < k ? w : w - k);                       \
+                                                                                \
+    /* Only total elements are taken, so an exhausted run never wins. */        \
+    for (long long out = 0; out < total; ++out)                                 \
+    {                                                                           \
+        dst[out] = key;                                                         \
+                                                                                \
+        if (++pos[w] < len[w])                                                  \
+            key = ((const T *)data[w])[pos[w]];                                 \
+        else                                                                    \
+        {                                                                       \
+            key = MAX;                                                          \
+            w += k;                                                             \
+        }                                                                       \
+                                                                                \
+        /* Replay the winner's path: only its own matches can change. */       \
+        for (int n = (k + (w < k ? w : w - k)) / 2; n >= 1; n /= 2)             \
+        {                                                                       \
+            /* Selects rather than branches: the outcome is unpredictable. */   \
+            bool swap = merge_less_##suffix(keys[n], tree[n], key, w);          \
+            T tk = keys[n];                                                     \
+            int ti = tree[n];                                                   \
+                                                                                \
+            keys[n] = swap ? key : tk;                                          \
+            tree[n] = swap ? w : ti;                                            \
+            key = swap ? tk : key;                                              \
+            w = swap ? ti : w;                                                  \
+        }                                                                       \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+/* Number of elements of all runs ordered before element p of run i. */         \
+static long long merge_rank_##suffix(const Merge_Run *runs, int k, int i, int p) \
+{                                                                               \
+    T x = ((const T *)runs[i].data)[p];                                         \
+    long long rank = p;                                                         \
+                                                                                \
+    for (int j = 0; j < k; ++j)                                                 \
+    {                                                                           \
+        const T *a = runs[j].data;                                              \
+        int lo = 0, hi = runs[j].len;                                           \
+                                                                                \
+        if (j == i)                                                             \
+            continue;                                                           \
+                                                                                \
+        /* Equal elements of earlier runs come first, of later runs after. */   \
+        while (lo < hi)                                                         \
+        {                                                                       \
+            int mid = lo + (hi - lo) / 2;                                       \
+            bool before = j < i ? !(x < a[mid]) : a[mid] < x;                   \
+                                                                                \
+            if (before)                                                         \
+                lo = mid + 1;                                                   \
+            else                                                                \
+                hi = mid;                                                       \
+        }                                                                       \
+                                                                                \
+        rank += lo;                                                             \
+    }                                                                           \
+                                                                                \
+    return rank;                                                                \
+}                                                                               \
+                                                                                \
+/* How many elements of every run have a rank below t. */                      \
+static void merge_split_##suffix(const Merge_Run *runs, int k, long long t, int *split) \
+{                                                                               \
+    for (int i = 0; i < k; ++i)                                                 \
+    {                                                                           \
+        int lo = 0, hi = runs[i].len;                                           \
+                                                                                \
+        while (lo < hi)                                                         \
+        {                                                                       \
+            int mid = lo + (hi - lo) / 2;                                       \
+                                                                                \
+            if (merge_rank_##suffix(runs, k, i, mid) < t)                       \
+                lo = mid + 1;                                                   \
+            else                                                                \
+                hi = mid;                                                       \
+        }                                                                       \
+                                                                                \
+        split[i] = lo;                                                          \
+    }                                                                           \
+}
+
+MERGE_DEFINE(int, int, INT_MAX)
+MERGE_DEFINE(long, long, LONG_MAX)
+MERGE_DEFINE(long_long, long long, LLONG_MAX)
+MERGE_DEFINE(float, float, INFINITY)
+MERGE_DEFINE(double, double, INFINITY)
+
+/*
+ * MERGE_DISPATCH()
+ * ----------------------
+ * Description:
+ *      Switches once on the type and calls the typed kernel.
+ */
+#define MERGE_DISPATCH(kernel, type, ...)                                       \
+    switch (type)                                                               \
+    {                                                                           \
+        case TYPE_INT:          kernel##_int(__VA_ARGS__);          break;      \
+        case TYPE_LONG:         kernel##_long(__VA_ARGS__);         break;      \
+        case TYPE_LONG_LONG:    kernel##_long_long(__VA_ARGS__);    break;      \
+        case TYPE_FLOAT:        kernel##_float(__VA_ARGS__);        break;      \
+        case TYPE_DOUBLE:       kernel##_double(__VA_ARGS__);       break;      \
+        default:                break;                                          \
+    }
+
+/* [ Helpers ] */
+
+/*
+ * merge_part()
+ * ----------------------
+ * Description:
+ *      Finds where the slice starts and ends in every run, then merges
+ *      it. Used as the thread entry point.
+ */
+static void *merge_part(void *arg)
+{
+    Merge_Part *part = arg;
+    size_t size = type_sizes[part->type];
+    long long total = part->end - part->begin;
+
+    if (total <= 0)
+        return NULL;
+
+    /* pos holds the start split, len the end split, until the merge. */
+    if (part->begin == 0)
+        memset(part->pos, 0, (size_t)part->k * sizeof(int));
+    else
+        MERGE_DISPATCH(merge_split, part->type, part->runs, part->k, part->begin, part->pos);
+
+    for (int i = 0; i < part->k; ++i)
+        part->len[i] = part->runs[i].len;
+
+    long long all = 0;
+
+    for (int i = 0; i < part->k; ++i)
+        all += part->runs[i].len;
+
+    if (part->end < all)
+        MERGE_DISPATCH(merge_split, part->type, part->runs, part->k, part->end, part->len);
+
+    for (int i = 0; i < part->k; ++i)
+    {
+        part->data[i] = (const char *)part->runs[i].data + (size_t)part->pos[i] * size;
+        part->len[i] -= part->pos[i];
+    }
+
+    MERGE_DISPATCH(merge_tree, part->type, part);
+    return NULL;
+}
+
+/*
+ * merge_threads()
+ * ----------------------
+ * Description:
+ *      Picks how many threads to use for an output of total elements.
+ */
+static int merge_threads(int threads, long long total)
+{
+    if (threads <= 0)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (int)online : 1;
+    }
+
+    long long most = total / MERGE_PARALLEL_MIN;
+
+    if (most < threads)
+        threads = most > 1 ? (int)most : 1;
+
+    return threads;
+}
+
+/* [ Functions ] */
+
+/*
+ * merge_k()
+ * ----------------------
+ * Description:
+ *      Merges k sorted arrays in one pass with a loser tree,
+ *      optionally splitting the output between threads.
+ */
+int merge_k(void *dst, const Merge_Run *runs, int k, Fetch_Type type, int threads)
+{
+    return merge_k_ctx(context_default(), dst, runs, k, type, threads);
+}
+
+/*
+ * merge_k_ctx()
+ * ----------------------
+ * Description:
+ *      merge_k() allocating and logging through the context.
+ */
+int merge_k_ctx(Utils_Context *ctx, void *dst, const Merge_Run *runs, int k, Fetch_Type type, int threads)
+{
+    long long total = 0;
+
+    if (k < 0 || (k > 0 && runs == NULL) || (unsigned)type > TYPE_DOUBLE)
+    {
+        print_log_ctx(ctx, "[ERROR]", RED, "Invalid k-way merge arguments\n");
+        return -1;
+    }
+
+    for (int i = 0; i < k; ++i)
+    {
+        if (runs[i].len < 0 || (runs[i].len > 0 && runs[i].data == NULL))
+        {
+            print_log_ctx(ctx, "[ERROR]", RED, "Invalid k-way merge run [ %d ]\n", i);
+            return -1;
+        }
+
+        total += runs[i].len;
+    }
+
+    if (total > INT_MAX || (total > 0 && dst == NULL))
+    {
+        print_log_ctx(ctx, "[ERROR]", RED, "Invalid k-way merge output\n");
+        return -1;
+    }
+
+    if (total == 0)
+        return 0;
+
+    int parts = merge_threads(threads, total);
+    size_t block = (size_t)k * (sizeof(void *) + sizeof(long long)) + (size_t)k * 5 * sizeof(int);
+    block = (block + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+    Merge_Part *part = context_alloc(ctx, (size_t)parts * (sizeof(Merge_Part) + block));
+
+    if (part == NULL)
+    {
+        print_log_ctx(ctx, "[ERROR]", RED, "Memory allocation failed for k-way merge\n");
+        return -1;
+    }
+
+    char *scratch = (char *)(part + parts);
+    size_t size = type_sizes[type];
+
+    for (int p = 0; p < parts; ++p, scratch += block)
+    {
+        part[p].runs = runs;
+        part[p].k = k;
+        part[p].type = type;
+        part[p].begin = total * p / parts;
+        part[p].end = total * (p + 1) / parts;
+        part[p].dst = (char *)dst + (size_t)part[p].begin * size;
+        part[p].data = (const void **)scratch;
+        part[p].keys = scratch + (size_t)k * sizeof(void *);
+        part[p].len = (int *)(scratch + (size_t)k * (sizeof(void *) + sizeof(long long)));
+        part[p].pos = part[p].len + k;
+        part[p].tree = part[p].pos + k;
+    }
+
+    if (parts == 1)
+    {
+        merge_part(&part[0]);
+        context_release(ctx, part);
+        return (int)total;
+    }
+
+    pthread_t *tid = context_alloc(ctx, (size_t)parts * sizeof(pthread_t));
+
+    if (tid == NULL)
+    {
+        for (int p = 0; p < parts; ++p)
+            merge_part(&part[p]);
+    }
+    else
+        thread_fork_join(merge_part, part, sizeof(*part), parts, tid);
+
+    context_release(ctx, tid);
+    context_release(ctx, part);
+    return (int)total;
+}
+
+/* merge_utils.c */
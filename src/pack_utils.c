@@ -0,0 +1,625 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : pack_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at storing sorted integer arrays compressed.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <pack_utils.h>
+#include <cpu_utils.h>
+
+#ifdef UTILS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/* [ Macros ] */
+
+#define PACK_PER_LANE (PACK_BLOCK / PACK_LANES)     // differences packed into each lane of a block
+
+/* [ Types ] */
+
+/* Unpacks the PACK_BLOCK differences of a block with 1 to 32 bits each. */
+typedef void (*Pack_Unpack_Fn)(const uint32_t *in, int bits, uint32_t *out);
+
+/* [ Helpers ] */
+
+/*
+ * pack_rows()
+ * ----------------------
+ * Description:
+ *      Rows of PACK_LANES words taken by a block packed with bits bits.
+ */
+static inline uint32_t pack_rows(int bits)
+{
+    if (bits == PACK_RAW)
+        return PACK_BLOCK * 2 / PACK_LANES;
+
+    return (uint32_t)(PACK_PER_LANE * bits + 31) / 32;
+}
+
+/*
+ * pack_pack()
+ * ----------------------
+ * Description:
+ *      Packs the differences of a block. Difference i goes to lane
+ *      i % PACK_LANES, so each row of unpacked lanes holds PACK_LANES
+ *      consecutive differences.
+ */
+static void pack_pack(const uint32_t *in, int bits, uint32_t *out)
+{
+    for (int lane = 0; lane < PACK_LANES; ++lane)
+    {
+        uint32_t *word = out + lane;
+        uint64_t acc = 0;
+        int filled = 0;
+
+        for (int k = 0; k < PACK_PER_LANE; ++k)
+        {
+            acc |= (uint64_t)in[k * PACK_LANES + lane] << filled;
+            filled += bits;
+
+            if (filled >= 32)
+            {
+                *word = (uint32_t)acc;
+                word += PACK_LANES;
+                acc >>= 32;
+                filled -= 32;
+            }
+        }
+
+        if (filled > 0)
+            *word = (uint32_t)acc;
+    }
+}
+
+/*
+ * pack_unpack()
+ * ----------------------
+ * Description:
+ *      Scalar counterpart of pack_pack().
+ */
+static void pack_unpack(const uint32_t *in, int bits, uint32_t *out)
+{
+    uint32_t mask = bits == 32 ? UINT32_MAX : (1u << bits) - 1;
+
+    for (int lane = 0; lane < PACK_LANES; ++lane)
+    {
+        const uint32_t *word = in + lane;
+        int shift = 0;
+
+        for (int k = 0; k < PACK_PER_LANE; ++k)
+        {
+            uint32_t value = word[0] >> shift;
+
+            /* The difference continues in the lane's next word. */
+            if (shift + bits > 32)
+                value |= word[PACK_LANES] << (32 - shift);
+
+            out[k * PACK_LANES + lane] = value & mask;
+            shift += bits;
+
+            if (shift >= 32)
+            {
+                word += PACK_LANES;
+                shift -= 32;
+            }
+        }
+    }
+}
+
+#ifdef UTILS_X86_SIMD
+/*
+ * pack_unpack_avx2()
+ * ----------------------
+ * Description:
+ *      pack_unpack() with the eight lanes of a row in one register.
+ *      All lanes share the same shifts, so every step unpacks eight
+ *      consecutive differences.
+ */
+__attribute__((target("avx2")))
+static void pack_unpack_avx2(const uint32_t *in, int bits, uint32_t *out)
+{
+    const __m256i mask = _mm256_set1_epi32(bits == 32 ? -1 : (int)((1u << bits) - 1));
+    __m256i word = _mm256_loadu_si256((const __m256i *)in);
+    int shift = 0;
+
+    for (int k = 0; k < PACK_PER_LANE; ++k)
+    {
+        __m256i value = _mm256_srl_epi32(word, _mm_cvtsi32_si128(shift));
+
+        shift += bits;
+
+        if (shift >= 32)
+        {
+            shift -= 32;
+            in += PACK_LANES;
+
+            /* Past the last difference there is no next row to load. */
+            if (shift > 0 || k < PACK_PER_LANE - 1)
+                word = _mm256_loadu_si256((const __m256i *)in);
+
+            if (shift > 0)
+                value = _mm256_or_si256(value, _mm256_sll_epi32(word, _mm_cvtsi32_si128(bits - shift)));
+        }
+
+        _mm256_storeu_si256((__m256i *)(out + k * PACK_LANES), _mm256_and_si256(value, mask));
+    }
+}
+#endif
+
+/*
+ * pack_unpacker()
+ * ----------------------
+ * Description:
+ *      Picks the unpacking kernel for the CPU tier.
+ */
+static Pack_Unpack_Fn pack_unpacker(void)
+{
+#ifdef UTILS_X86_SIMD
+    static const Pack_Unpack_Fn tiers[CPU_TIERS] = {
+        [CPU_TIER_SCALAR] = pack_unpack,
+        [CPU_TIER_SSE2] = pack_unpack,
+        [CPU_TIER_AVX2] = pack_unpack_avx2,
+        [CPU_TIER_AVX512] = pack_unpack_avx2,
+    };
+
+    return tiers[cpu_tier()];
+#else
+    return pack_unpack;
+#endif
+}
+
+/*
+ * pack_valid()
+ * ----------------------
+ * Description:
+ *      Checks that a compressed array can be read.
+ */
+static inline bool pack_valid(const Pack_Array *pack)
+{
+    return pack != NULL && pack->len >= 0 && (pack->skips != NULL || pack->len == 0);
+}
+
+/*
+ * PACK_DEFINE()
+ * ----------------------
+ * Description:
+ *      Generates the loading, decoding, searching and intersecting
+ *      kernels of one integer type. UT is its unsigned counterpart, in
+ *      which the differences are summed so that wrapping is defined.
+ */
+#define PACK_DEFINE(suffix, T, UT)                                              \
+static void pack_load_##suffix(const T *arr, int n, long long *out)             \
+{                                                                               \
+    for (int i = 0; i < n; ++i)                                                 \
+        out[i] = arr[i];                                                        \
+}                                                                               \
+                                                                                \
+static int pack_block_##suffix(const Pack_Array *pack, int b, Pack_Unpack_Fn unpack, T *out) \
+{                                                                               \
+    const Pack_Skip *skip = &pack->skips[b];                                    \
+    const uint32_t *in = pack->words + (size_t)skip->row * PACK_LANES;          \
+    int n = pack->len - b * PACK_BLOCK;                                         \
+    UT value = (UT)skip->first;                                                 \
+                                                                                \
+    n = n < PACK_BLOCK ? n : PACK_BLOCK;                                        \
+                                                                                \
+    if (skip->bits == PACK_RAW)                                                 \
+    {                                                                           \
+        for (int i = 0; i < n; ++i)                                             \
+        {                                                                       \
+            value += (UT)((uint64_t)in[2 * i] | (uint64_t)in[2 * i + 1] << 32); \
+            out[i] = (T)value;                                                  \
+        }                                                                       \
+    }                                                                           \
+    else if (skip->bits == 0)                                                   \
+    {                                                                           \
+        for (int i = 0; i < n; ++i)                                             \
+            out[i] = (T)value;                                                  \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        uint32_t diff[PACK_BLOCK];                                              \
+                                                                                \
+        unpack(in, skip->bits, diff);                                           \
+                                                                                \
+        for (int i = 0; i < n; ++i)                                             \
+        {                                                                       \
+            value += diff[i];                                                   \
+            out[i] = (T)value;                                                  \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    return n;                                                                   \
+}                                                                               \
+                                                                                \
+static int pack_decode_##suffix(const Pack_Array *pack, T *dst, Pack_Unpack_Fn unpack) \
+{                                                                               \
+    for (int b = 0; b < pack->blocks; ++b)                                      \
+        dst += pack_block_##suffix(pack, b, unpack, dst);                       \
+                                                                                \
+    return pack->len;                                                           \
+}                                                                               \
+                                                                                \
+static int pack_get_##suffix(const Pack_Array *pack, int index, T *value, Pack_Unpack_Fn unpack) \
+{                                                                               \
+    T buf[PACK_BLOCK];                                                          \
+                                                                                \
+    pack_block_##suffix(pack, index / PACK_BLOCK, unpack, buf);                 \
+    *value = buf[index % PACK_BLOCK];                                           \
+    return 0;                                                                   \
+}                                                                               \
+                                                                                \
+/* First position from pos on in a decoded block whose value is not less than key. */ \
+static inline int pack_find_##suffix(const T *buf, int pos, int n, T key)       \
+{                                                                               \
+    while (pos < n)                                                             \
+    {                                                                           \
+        int mid = pos + (n - pos) / 2;                                          \
+                                                                                \
+        if (buf[mid] < key)                                                     \
+            pos = mid + 1;                                                      \
+        else                                                                    \
+            n = mid;                                                            \
+    }                                                                           \
+                                                                                \
+    return pos;                                                                 \
+}                                                                               \
+                                                                                \
+static int pack_lower_bound_##suffix(const Pack_Array *pack, T key, Pack_Unpack_Fn unpack) \
+{                                                                               \
+    T buf[PACK_BLOCK];                                                          \
+    int lo = 0, hi = pack->blocks;                                              \
+                                                                                \
+    /* The first block starting at or after the key... */                      \
+    while (lo < hi)                                                             \
+    {                                                                           \
+        int mid = lo + (hi - lo) / 2;                                           \
+                                                                                \
+        if (pack->skips[mid].first < key)                                       \
+            lo = mid + 1;                                                       \
+        else                                                                    \
+            hi = mid;                                                           \
+    }                                                                           \
+                                                                                \
+    if (lo == 0)                                                                \
+        return 0;                                                               \
+                                                                                \
+    /* ...so the answer is in the block before it, or at its start. */        \
+    int n = pack_block_##suffix(pack, lo - 1, unpack, buf);                     \
+    return (lo - 1) * PACK_BLOCK + pack_find_##suffix(buf, 0, n, key);          \
+}                                                                               \
+                                                                                \
+/* Moves a cursor to the first value not less than key, skipping whole blocks. */ \
+static int pack_seek_##suffix(const Pack_Array *pack, int *block, int *n, T *buf, int pos, T key, Pack_Unpack_Fn unpack) \
+{                                                                               \
+    int b = *block;                                                             \
+                                                                                \
+    if (b + 1 < pack->blocks && pack->skips[b + 1].first < key)                 \
+    {                                                                           \
+        int lo = b + 2, hi = pack->blocks;                                      \
+                                                                                \
+        while (lo < hi)                                                         \
+        {                                                                       \
+            int mid = lo + (hi - lo) / 2;                                       \
+                                                                                \
+            if (pack->skips[mid].first < key)                                   \
+                lo = mid + 1;                                                   \
+            else                                                                \
+                hi = mid;                                                       \
+        }                                                                       \
+                                                                                \
+        *block = lo - 1;                                                        \
+        *n = pack_block_##suffix(pack, lo - 1, unpack, buf);                    \
+        pos = 0;                                                                \
+    }                                                                           \
+                                                                                \
+    return pack_find_##suffix(buf, pos, *n, key);                               \
+}                                                                               \
+                                                                                \
+static int pack_intersect_##suffix(T *dst, const Pack_Array *a, const Pack_Array *b, Pack_Unpack_Fn unpack) \
+{                                                                               \
+    T abuf[PACK_BLOCK], bbuf[PACK_BLOCK];                                       \
+    int ab = 0, bb = 0, ai = 0, bi = 0, k = 0;                                  \
+                                                                                \
+    if (a->len == 0 || b->len == 0)                                             \
+        return 0;                                                               \
+                                                                                \
+    int an = pack_block_##suffix(a, 0, unpack, abuf);                           \
+    int bn = pack_block_##suffix(b, 0, unpack, bbuf);                           \
+                                                                                \
+    for (;;)                                                                    \
+    {                                                                           \
+        if (ai == an)                                                           \
+        {                                                                       \
+            if (++ab == a->blocks)                                              \
+                break;                                                          \
+            an = pack_block_##suffix(a, ab, unpack, abuf);                      \
+            ai = 0;                                                             \
+        }                                                                       \
+                                                                                \
+        if (bi == bn)                                                           \
+        {                                                                       \
+            if (++bb == b->blocks)                                              \
+                break;                                                          \
+            bn = pack_block_##suffix(b, bb, unpack, bbuf);                      \
+            bi = 0;                                                             \
+        }                                                                       \
+                                                                                \
+        T x = abuf[ai], y = bbuf[bi];                                           \
+                                                                                \
+        if (x < y)                                                              \
+            ai = pack_seek_##suffix(a, &ab, &an, abuf, ai, y, unpack);          \
+        else if (y < x)                                                         \
+            bi = pack_seek_##suffix(b, &bb, &bn, bbuf, bi, x, unpack);          \
+        else                                                                    \
+        {                                                                       \
+            dst[k++] = x;                                                       \
+            ai++;                                                               \
+            bi++;                                                               \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    return k;                                                                   \
+}
+
+PACK_DEFINE(int, int, unsigned int)
+PACK_DEFINE(long, long, unsigned long)
+PACK_DEFINE(long_long, long long, unsigned long long)
+
+/*
+ * pack_load()
+ * ----------------------
+ * Description:
+ *      Widens n elements starting at start to long long.
+ */
+static void pack_load(const void *arr, int start, int n, Fetch_Type type, long long *out)
+{
+    switch (type)
+    {
+        case TYPE_INT:          pack_load_int((const int *)arr + start, n, out);                break;
+        case TYPE_LONG:         pack_load_long((const long *)arr + start, n, out);              break;
+        case TYPE_LONG_LONG:    pack_load_long_long((const long long *)arr + start, n, out);    break;
+        default:                break;
+    }
+}
+
+/*
+ * PACK_DISPATCH()
+ * ----------------------
+ * Description:
+ *      Switches once on the integer type and returns the typed kernel's result.
+ */
+#define PACK_DISPATCH(kernel, type, ...)                                        \
+    switch (type)                                                               \
+    {                                                                           \
+        case TYPE_INT:          return kernel##_int(__VA_ARGS__);               \
+        case TYPE_LONG:         return kernel##_long(__VA_ARGS__);              \
+        case TYPE_LONG_LONG:    return kernel##_long_long(__VA_ARGS__);         \
+        default:                return -1;                                      \
+    }
+
+/* [ Functions ] */
+
+/*
+ * pack_build()
+ * ----------------------
+ * Description:
+ *      Compresses a sorted integer array.
+ */
+int pack_build(Pack_Array *pack, const void *arr, int len, Fetch_Type type)
+{
+    if (pack == NULL)
+        return -1;
+
+    /* Cleared first, so pack_free() is safe after any failure. */
+    memset(pack, 0, sizeof(*pack));
+
+    if (len < 0 || (arr == NULL && len > 0))
+        return -1;
+
+    if (type != TYPE_INT && type != TYPE_LONG && type != TYPE_LONG_LONG)
+    {
+        print_log("[ERROR]", RED, "Only integer arrays can be packed\n");
+        return -1;
+    }
+
+    pack->len = len;
+    pack->type = type;
+    pack->blocks = (len + PACK_BLOCK - 1) / PACK_BLOCK;
+
+    if (len == 0)
+        return 0;
+
+    pack->skips = malloc((size_t)pack->blocks * sizeof(Pack_Skip));
+    if (pack->skips == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for packed array\n");
+        return -1;
+    }
+
+    long long vals[PACK_BLOCK];
+    long long prev = 0;
+
+    /* First pass: sizes every block, so the words are allocated once. */
+    for (int b = 0; b < pack->blocks; ++b)
+    {
+        int start = b * PACK_BLOCK;
+        int n = len - start < PACK_BLOCK ? len - start : PACK_BLOCK;
+        unsigned long long widest = 0;
+
+        pack_load(arr, start, n, type, vals);
+
+        for (int i = 0; i < n; ++i)
+        {
+            if (vals[i] < prev && (b > 0 || i > 0))
+            {
+                print_log("[ERROR]", RED, "Array is not sorted at index [ %d ]\n", start + i);
+                pack_free(pack);
+                return -1;
+            }
+
+            if (i > 0 && (unsigned long long)vals[i] - (unsigned long long)vals[i - 1] > widest)
+                widest = (unsigned long long)vals[i] - (unsigned long long)vals[i - 1];
+
+            prev = vals[i];
+        }
+
+        int bits = 0;
+        while (bits < 64 && (widest >> bits) != 0)
+            bits++;
+
+        pack->skips[b].first = vals[0];
+        pack->skips[b].row = (uint32_t)pack->rows;
+        pack->skips[b].bits = (uint8_t)(bits > 32 ? PACK_RAW : bits);
+        pack->rows += pack_rows(pack->skips[b].bits);
+    }
+
+    pack->words = malloc((pack->rows > 0 ? pack->rows : 1) * PACK_LANES * sizeof(uint32_t));
+    if (pack->words == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for packed array\n");
+        pack_free(pack);
+        return -1;
+    }
+
+    /* Second pass: packs the differences, the first of every block being 0. */
+    for (int b = 0; b < pack->blocks; ++b)
+    {
+        int start = b * PACK_BLOCK;
+        int n = len - start < PACK_BLOCK ? len - start : PACK_BLOCK;
+        const Pack_Skip *skip = &pack->skips[b];
+        uint32_t *out = pack->words + (size_t)skip->row * PACK_LANES;
+
+        pack_load(arr, start, n, type, vals);
+
+        if (skip->bits == PACK_RAW)
+        {
+            for (int i = 0; i < PACK_BLOCK; ++i)
+            {
+                uint64_t diff = i > 0 && i < n ? (unsigned long long)vals[i] - (unsigned long long)vals[i - 1] : 0;
+
+                out[2 * i] = (uint32_t)diff;
+                out[2 * i + 1] = (uint32_t)(diff >> 32);
+            }
+        }
+        else if (skip->bits > 0)
+        {
+            uint32_t diff[PACK_BLOCK] = { 0 };
+
+            for (int i = 1; i < n; ++i)
+                diff[i] = (uint32_t)((unsigned long long)vals[i] - (unsigned long long)vals[i - 1]);
+
+            pack_pack(diff, skip->bits, out);
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * pack_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a compressed array.
+ */
+void pack_free(Pack_Array *pack)
+{
+    if (pack == NULL)
+        return;
+
+    free(pack->skips);
+    free(pack->words);
+    pack->skips = NULL;
+    pack->words = NULL;
+    pack->rows = 0;
+    pack->blocks = 0;
+    pack->len = 0;
+}
+
+/*
+ * pack_bytes()
+ * ----------------------
+ * Description:
+ *      Returns the memory used by the blocks and skip entries.
+ */
+size_t pack_bytes(const Pack_Array *pack)
+{
+    if (pack == NULL)
+        return 0;
+
+    return (size_t)pack->blocks * sizeof(Pack_Skip) + pack->rows * PACK_LANES * sizeof(uint32_t);
+}
+
+/*
+ * pack_decode()
+ * ----------------------
+ * Description:
+ *      Decompresses the whole array.
+ */
+int pack_decode(const Pack_Array *pack, void *dst)
+{
+    if (!pack_valid(pack) || (dst == NULL && pack->len > 0))
+        return -1;
+
+    PACK_DISPATCH(pack_decode, pack->type, pack, dst, pack_unpacker());
+}
+
+/*
+ * pack_get()
+ * ----------------------
+ * Description:
+ *      Reads one element, decoding only its block.
+ */
+int pack_get(const Pack_Array *pack, int index, void *value)
+{
+    if (!pack_valid(pack) || value == NULL || index < 0 || index >= pack->len)
+        return -1;
+
+    PACK_DISPATCH(pack_get, pack->type, pack, index, value, pack_unpacker());
+}
+
+/*
+ * pack_lower_bound()
+ * ----------------------
+ * Description:
+ *      Finds the first element not less than the key.
+ */
+int pack_lower_bound(const Pack_Array *pack, const void *key)
+{
+    if (!pack_valid(pack) || key == NULL)
+        return -1;
+
+    switch (pack->type)
+    {
+        case TYPE_INT:          return pack_lower_bound_int(pack, *(const int *)key, pack_unpacker());
+        case TYPE_LONG:         return pack_lower_bound_long(pack, *(const long *)key, pack_unpacker());
+        case TYPE_LONG_LONG:    return pack_lower_bound_long_long(pack, *(const long long *)key, pack_unpacker());
+        default:                return -1;
+    }
+}
+
+/*
+ * pack_intersection()
+ * ----------------------
+ * Description:
+ *      Writes the elements present in both compressed arrays.
+ */
+int pack_intersection(void *dst, const Pack_Array *a, const Pack_Array *b)
+{
+    if (dst == NULL || !pack_valid(a) || !pack_valid(b) || a->type != b->type)
+        return -1;
+
+    PACK_DISPATCH(pack_intersect, a->type, dst, a, b, pack_unpacker());
+}
+
+/* pack_utils.c */
@@ -0,0 +1,323 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : perf_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at measuring code with hardware performance counters.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <perf_utils.h>
+#include <stdatomic.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/perf_event.h>)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#define PERF_HAVE_EVENTS    // perf_event_open() can be tried at runtime
+#endif
+#endif
+
+/* [ Arrays ] */
+
+static const char *const perf_names[PERF_EVENTS] = {
+    [PERF_CYCLES] = "cycles",
+    [PERF_INSTRUCTIONS] = "instructions",
+    [PERF_BRANCH_MISSES] = "branch-misses",
+    [PERF_L1D_MISSES] = "L1d-misses",
+    [PERF_LLC_MISSES] = "LLC-misses",
+    [PERF_PAGE_FAULTS] = "page-faults",
+};
+
+#ifdef PERF_HAVE_EVENTS
+static const struct { __u32 type; __u64 config; } perf_configs[PERF_EVENTS] = {
+    [PERF_CYCLES] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    [PERF_INSTRUCTIONS] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    [PERF_BRANCH_MISSES] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    [PERF_L1D_MISSES] = { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+                                              | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                              | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    [PERF_LLC_MISSES] = { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    [PERF_PAGE_FAULTS] = { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+};
+#endif
+
+/* [ Helpers ] */
+
+/*
+ * perf_clock()
+ * ----------------------
+ * Description:
+ *      Monotonic time in seconds.
+ */
+static double perf_clock(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * perf_faults()
+ * ----------------------
+ * Description:
+ *      Page faults of the calling thread so far, or of the process
+ *      where per-thread usage is not available.
+ */
+static long perf_faults(void)
+{
+    struct rusage usage;
+
+#ifdef RUSAGE_THREAD
+    if (getrusage(RUSAGE_THREAD, &usage) == 0)
+        return usage.ru_minflt + usage.ru_majflt;
+#endif
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return usage.ru_minflt + usage.ru_majflt;
+
+    return 0;
+}
+
+#ifdef PERF_HAVE_EVENTS
+/*
+ * perf_event_fd()
+ * ----------------------
+ * Description:
+ *      Opens one disabled user-space counter on the calling thread,
+ *      returning -1 if it is not permitted or not supported.
+ */
+static int perf_event_fd(Perf_Event event)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = perf_configs[event].type;
+    attr.config = perf_configs[event].config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+}
+#endif
+
+/* [ Functions ] */
+
+/*
+ * perf_open()
+ * ----------------------
+ * Description:
+ *      Opens every counter the system allows.
+ */
+int perf_open(Perf_Counters *pc)
+{
+    static atomic_bool warned = false;
+    int opened = 0;
+
+    for (int e = 0; e < PERF_EVENTS; ++e)
+    {
+#ifdef PERF_HAVE_EVENTS
+        pc->fds[e] = perf_event_fd((Perf_Event)e);
+#else
+        pc->fds[e] = -1;
+#endif
+        opened += pc->fds[e] >= 0;
+    }
+
+    pc->start = 0.0;
+    pc->faults = 0;
+
+    if (opened == 0 && !atomic_exchange(&warned, true))
+        print_log("[WARNING]", YELLOW, "Performance counters unavailable, measuring time only "
+                  "(see /proc/sys/kernel/perf_event_paranoid)\n");
+
+    return opened;
+}
+
+/*
+ * perf_start()
+ * ----------------------
+ * Description:
+ *      Resets and starts the counters.
+ */
+void perf_start(Perf_Counters *pc)
+{
+    pc->faults = perf_faults();
+
+#ifdef PERF_HAVE_EVENTS
+    for (int e = 0; e < PERF_EVENTS; ++e)
+    {
+        if (pc->fds[e] >= 0)
+            ioctl(pc->fds[e], PERF_EVENT_IOC_RESET, 0);
+    }
+
+    for (int e = 0; e < PERF_EVENTS; ++e)
+    {
+        if (pc->fds[e] >= 0)
+            ioctl(pc->fds[e], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+
+    /* Read last, so the clock does not time the ioctl() calls. */
+    pc->start = perf_clock();
+}
+
+/*
+ * perf_stop()
+ * ----------------------
+ * Description:
+ *      Stops and reads the counters.
+ */
+void perf_stop(Perf_Counters *pc, Perf_Sample *sample)
+{
+    sample->seconds = perf_clock() - pc->start;
+
+#ifdef PERF_HAVE_EVENTS
+    for (int e = 0; e < PERF_EVENTS; ++e)
+    {
+        if (pc->fds[e] >= 0)
+            ioctl(pc->fds[e], PERF_EVENT_IOC_DISABLE, 0);
+    }
+#endif
+
+    for (int e = 0; e < PERF_EVENTS; ++e)
+    {
+        sample->values[e] = 0;
+        sample->valid[e] = false;
+
+#ifdef PERF_HAVE_EVENTS
+        uint64_t data[3];   // value, time enabled, time running
+
+        if (pc->fds[e] < 0 || read(pc->fds[e], data, sizeof(data)) != (ssize_t)sizeof(data))
+            continue;
+
+        /* A counter that never got onto the PMU measured nothing. */
+        if (data[2] == 0)
+            continue;
+
+        sample->values[e] = data[2] < data[1]
+            ? (uint64_t)((double)data[0] * ((double)data[1] / (double)data[2]))
+            : data[0];
+        sample->valid[e] = true;
+#endif
+    }
+
+    if (!sample->valid[PERF_PAGE_FAULTS])
+    {
+        long faults = perf_faults() - pc->faults;
+
+        sample->values[PERF_PAGE_FAULTS] = faults > 0 ? (uint64_t)faults : 0;
+        sample->valid[PERF_PAGE_FAULTS] = true;
+    }
+}
+
+/*
+ * perf_close()
+ * ----------------------
+ * Description:
+ *      Closes the counters.
+ */
+void perf_close(Perf_Counters *pc)
+{
+    for (int e = 0; e < PERF_EVENTS; ++e)
+    {
+        if (pc->fds[e] >= 0)
+            close(pc->fds[e]);
+
+        pc->fds[e] = -1;
+    }
+}
+
+/*
+ * perf_event_name()
+ * ----------------------
+ * Description:
+ *      Returns the short name of an event.
+ */
+const char *perf_event_name(Perf_Event event)
+{
+    return (unsigned)event < PERF_EVENTS ? perf_names[event] : "?";
+}
+
+/*
+ * perf_count()
+ * ----------------------
+ * Description:
+ *      Appends a count with a K, M or G suffix.
+ */
+static void perf_count(Utils_Context *ctx, uint64_t value)
+{
+    if (value >= 10000000000ULL)
+        context_append(ctx, "%.1fG", (double)value * 1e-9);
+    else if (value >= 10000000ULL)
+        context_append(ctx, "%.1fM", (double)value * 1e-6);
+    else if (value >= 10000ULL)
+        context_append(ctx, "%.1fK", (double)value * 1e-3);
+    else
+        context_append(ctx, "%llu", (unsigned long long)value);
+}
+
+/*
+ * Function: perf_report()
+ * ----------------------
+ * Description:
+ *      Prints one line for a measured case.
+ */
+void perf_report(const char *name, const Perf_Sample *sample)
+{
+    perf_report_ctx(context_default(), name, sample);
+}
+
+/*
+ * perf_report_ctx()
+ * ----------------------
+ * Description:
+ *      perf_report() on an explicit context, written as one record.
+ */
+void perf_report_ctx(Utils_Context *ctx, const char *name, const Perf_Sample *sample)
+{
+    context_begin(ctx, ctx->out);
+
+    if (ctx->color)
+        context_write(ctx, BOLD, strlen(BOLD));
+    context_append(ctx, "%s:", name);
+    if (ctx->color)
+        context_write(ctx, RESET, strlen(RESET));
+
+    context_append(ctx, " %.3f ms", sample->seconds * 1e3);
+
+    for (int e = 0; e < PERF_EVENTS; ++e)
+    {
+        context_append(ctx, " | %s ", perf_names[e]);
+
+        if (!sample->valid[e])
+        {
+            context_write(ctx, "n/a", 3);
+            continue;
+        }
+
+        perf_count(ctx, sample->values[e]);
+
+        if (e == PERF_INSTRUCTIONS && sample->valid[PERF_CYCLES] && sample->values[PERF_CYCLES] > 0)
+            context_append(ctx, " (%.2f IPC)", (double)sample->values[e] / (double)sample->values[PERF_CYCLES]);
+    }
+
+    context_write(ctx, "\n", 1);
+    context_end(ctx);
+}
+
+/* perf_utils.c */
@@ -18,6 +18,10 @@
 #include <custom_utils.h>
 #include <print_utils.h>
 
+/* [ Macros ] */
+
+#define PRINT_VALUE_MAX (64)    // longest value rendered on the stack
+
 /* [ Colours ] */
 
 const Color RED = { "\x1b[31m", NULL };
@@ -29,7 +33,7 @@ const Color CYAN = { "\x1b[36m", NULL };
 
 /* [ Arrays ]*/
 
-size_t type_sizes[] = {
+const size_t type_sizes[] = {
     [TYPE_INT] = sizeof(int),
     [TYPE_LONG] = sizeof(long),
     [TYPE_LONG_LONG] = sizeof(long long),
@@ -37,6 +41,48 @@ size_t type_sizes[] = {
     [TYPE_DOUBLE] = sizeof(double),
 };
 
+/* [ Helpers ] */
+
+/*
+ * print_color()
+ * ----------------------
+ * Description:
+ *      Appends an escape sequence to the record if colours are enabled.
+ */
+static inline void print_color(Utils_Context *ctx, const char *code)
+{
+    if (ctx->color && code != NULL)
+        context_write(ctx, code, strlen(code));
+}
+
+/*
+ * print_vlog()
+ * ----------------------
+ * Description:
+ *      Formats a whole log message and writes it to the error stream
+ *      as a single record.
+ */
+static void print_vlog(Utils_Context *ctx, const char *prefix, Color color, const char *format, va_list args)
+{
+    context_begin(ctx, ctx->err);
+
+    if (color.fg_color)
+    {
+        print_color(ctx, color.fg_color);
+        print_color(ctx, color.bg_color);
+        print_color(ctx, BOLD);
+        context_append(ctx, "%s", prefix);
+        print_color(ctx, RESET);
+        context_write(ctx, " ", 1);
+        print_color(ctx, color.fg_color);
+        print_color(ctx, color.bg_color);
+    }
+
+    context_vappend(ctx, format, args);
+    print_color(ctx, RESET);
+    context_end(ctx);
+}
+
 /* [ Functions ] */
 
 /*
@@ -51,13 +97,213 @@ size_t type_sizes[] = {
  *      - Updated in v1.1.0
  */
 void print_divider(size_t len, Char_Type divider)
+{
+    print_divider_ctx(context_default(), len, divider);
+}
+
+/*
+ * print_divider_ctx()
+ * ----------------------
+ * Description:
+ *      print_divider() on an explicit context.
+ */
+void print_divider_ctx(Utils_Context *ctx, size_t len, Char_Type divider)
 {
     char ch = char_determ(divider);
 
+    context_begin(ctx, ctx->out);
+
     for (size_t i = 0; i < len; ++i)
-        printf("%c", ch);
+        context_write(ctx, &ch, 1);
 
-    printf("\n");
+    context_write(ctx, "\n", 1);
+    context_end(ctx);
+}
+
+/*
+ * print_split()
+ * ----------------------
+ * Description:
+ *      How many items to show from each end of len items, at most max
+ *      in total. Returns whether the middle is elided.
+ */
+static bool print_split(int max, int len, int *head, int *tail)
+{
+    if (max <= 0 || len <= max)
+    {
+        *head = len;
+        *tail = 0;
+        return false;
+    }
+
+    *head = (max + 1) / 2;
+    *tail = max / 2;
+    return true;
+}
+
+/*
+ * print_shown()
+ * ----------------------
+ * Description:
+ *      Index of the item shown at position pos, or -1 for the
+ *      ellipsis.
+ */
+static inline int print_shown(int pos, int len, int head, int tail, bool elided)
+{
+    if (!elided || pos < head)
+        return pos;
+
+    return pos == head ? -1 : len - tail + (pos - head - 1);
+}
+
+/*
+ * print_pad()
+ * ----------------------
+ * Description:
+ *      Right-aligns the next n characters to width.
+ */
+static void print_pad(Utils_Context *ctx, int n, int width)
+{
+    static const char spaces[] = "                                ";
+
+    for (width -= n; width > 0; width -= (int)sizeof(spaces) - 1)
+        context_write(ctx, spaces, (size_t)(width < (int)sizeof(spaces) - 1 ? width : (int)sizeof(spaces) - 1));
+}
+
+/*
+ * PRINT_ARRAY_DEFINE()
+ * ----------------------
+ * Description:
+ *      Generates print_render_<type>(), which formats a single value,
+ *      print_widths_<type>(), which measures the shown columns of a
+ *      matrix, print_format_<type>(), which appends one array to the
+ *      current record and whose loop only ever prints one type, and the
+ *      public print_array_<type>() on top of them. Only the elements that
+ *      are shown are ever formatted.
+ */
+#define PRINT_ARRAY_DEFINE(suffix, T, FMT, PRECISION)                           \
+static inline int print_render_##suffix(Utils_Context *ctx, char *buf, T value) \
+{                                                                               \
+    (void)ctx;                                                                  \
+    return snprintf(buf, PRINT_VALUE_MAX, FMT, PRECISION, value);               \
+}                                                                               \
+                                                                                \
+static void print_widths_##suffix(Utils_Context *ctx, const T *const *rows, int row_cnt, int len, int *widths) \
+{                                                                               \
+    char buf[PRINT_VALUE_MAX];                                                  \
+    int head, tail, rhead, rtail;                                               \
+    bool elided = print_split(ctx->print.max_elements, len, &head, &tail);      \
+    bool relided = print_split(ctx->print.max_rows, row_cnt, &rhead, &rtail);   \
+    int shown = elided ? head + tail + 1 : len;                                 \
+    int rshown = relided ? rhead + rtail + 1 : row_cnt;                         \
+                                                                                \
+    for (int pos = 0; pos < shown; ++pos)                                       \
+        widths[pos] = 3;                                                        \
+                                                                                \
+    for (int r = 0; r < rshown; ++r)                                            \
+    {                                                                           \
+        int row = print_shown(r, row_cnt, rhead, rtail, relided);               \
+                                                                                \
+        for (int pos = 0; row >= 0 && pos < shown; ++pos)                       \
+        {                                                                       \
+            int i = print_shown(pos, len, head, tail, elided);                  \
+            int n = i < 0 ? 0 : print_render_##suffix(ctx, buf, rows[row][i]);  \
+                                                                                \
+            widths[pos] = n > widths[pos] ? n : widths[pos];                    \
+        }                                                                       \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static void print_format_##suffix(Utils_Context *ctx, const T *arr, int len, const char *msg, const int *widths) \
+{                                                                               \
+    char buf[PRINT_VALUE_MAX];                                                  \
+    int head, tail;                                                             \
+    bool elided = print_split(ctx->print.max_elements, len, &head, &tail);      \
+    int shown = elided ? head + tail + 1 : len;                                 \
+                                                                                \
+    print_color(ctx, BOLD);                                                     \
+    context_append(ctx, "%s ", msg);                                            \
+    print_color(ctx, RESET);                                                    \
+    context_write(ctx, "{ ", 2);                                                \
+    print_color(ctx, GREEN.fg_color);                                           \
+                                                                                \
+    for (int pos = 0; pos < shown; ++pos)                                       \
+    {                                                                           \
+        int i = print_shown(pos, len, head, tail, elided);                      \
+        int n = i < 0 ? 3 : print_render_##suffix(ctx, buf, arr[i]);           \
+                                                                                \
+        if (widths != NULL)                                                     \
+            print_pad(ctx, n, widths[pos]);                                     \
+                                                                                \
+        if (i < 0)                                                              \
+            context_write(ctx, "...", 3);                                       \
+        else if (n < PRINT_VALUE_MAX)                                           \
+            context_write(ctx, buf, (size_t)n);                                 \
+        else                                                                    \
+            context_append(ctx, FMT, PRECISION, arr[i]);                        \
+                                                                                \
+        if (pos < shown - 1)                                                    \
+            context_write(ctx, ", ", 2);                                        \
+    }                                                                           \
+                                                                                \
+    print_color(ctx, RESET);                                                    \
+    context_write(ctx, " }\n", 3);                                              \
+}                                                                               \
+                                                                                \
+void print_array_##suffix(const T *arr, int len, const char *msg)               \
+{                                                                               \
+    Utils_Context *ctx = context_default();                                     \
+                                                                                \
+    context_begin(ctx, ctx->out);                                               \
+    print_format_##suffix(ctx, arr, len, msg, NULL);                            \
+    context_end(ctx);                                                           \
+}
+
+/* Integers go through "%.*d" with a precision of 1, which prints like "%d". */
+PRINT_ARRAY_DEFINE(int, int, "%.*d", 1)
+PRINT_ARRAY_DEFINE(long, long, "%.*ld", 1)
+PRINT_ARRAY_DEFINE(long_long, long long, "%.*lld", 1)
+PRINT_ARRAY_DEFINE(float, float, "%.*f", ctx->print.float_precision)
+PRINT_ARRAY_DEFINE(double, double, "%.*lf", ctx->print.double_precision)
+
+/*
+ * print_format()
+ * ----------------------
+ * Description:
+ *      Appends an array to the current record, switching on the
+ *      type once per call.
+ */
+static bool print_format(Utils_Context *ctx, const void *arr, int len, const char *msg, Fetch_Type type, const int *widths)
+{
+    switch (type)
+    {
+        case TYPE_INT:          print_format_int(ctx, arr, len, msg, widths);           return true;
+        case TYPE_LONG:         print_format_long(ctx, arr, len, msg, widths);          return true;
+        case TYPE_LONG_LONG:    print_format_long_long(ctx, arr, len, msg, widths);     return true;
+        case TYPE_FLOAT:        print_format_float(ctx, arr, len, msg, widths);         return true;
+        case TYPE_DOUBLE:       print_format_double(ctx, arr, len, msg, widths);        return true;
+        default:                return false;
+    }
+}
+
+/*
+ * print_widths()
+ * ----------------------
+ * Description:
+ *      Measures the shown columns of a matrix, switching on the
+ *      type once per call.
+ */
+static void print_widths(Utils_Context *ctx, void **matrix, int rows, int cols, Fetch_Type type, int *widths)
+{
+    switch (type)
+    {
+        case TYPE_INT:          print_widths_int(ctx, (const int *const *)matrix, rows, cols, widths);                  break;
+        case TYPE_LONG:         print_widths_long(ctx, (const long *const *)matrix, rows, cols, widths);                break;
+        case TYPE_LONG_LONG:    print_widths_long_long(ctx, (const long long *const *)matrix, rows, cols, widths);      break;
+        case TYPE_FLOAT:        print_widths_float(ctx, (const float *const *)matrix, rows, cols, widths);              break;
+        case TYPE_DOUBLE:       print_widths_double(ctx, (const double *const *)matrix, rows, cols, widths);            break;
+        default:                break;
+    }
 }
 
 /*
@@ -68,19 +314,26 @@ void print_divider(size_t len, Char_Type divider)
  */
 void print_array(void *arr, int len, const char *msg, Fetch_Type type)
 {
-    printf(BOLD "%s " RESET, msg);
-    printf("{ ");
-    printf(GREEN.fg_color);
+    print_array_ctx(context_default(), arr, len, msg, type);
+}
 
-    for (int i = 0; i < len; ++i)
-    {
-        print_type_determ(arr, type, i);
+/*
+ * print_array_ctx()
+ * ----------------------
+ * Description:
+ *      print_array() on an explicit context, written as one record.
+ */
+void print_array_ctx(Utils_Context *ctx, const void *arr, int len, const char *msg, Fetch_Type type)
+{
+    context_begin(ctx, ctx->out);
 
-        if (i < len - 1)
-            printf(", ");
+    if (!print_format(ctx, arr, len, msg, type, NULL))
+    {
+        print_log_ctx(ctx, "[ERROR]", RED, "Unexpected type\n");
+        return;
     }
 
-    printf(RESET " }\n");
+    context_end(ctx);
 }
 
 /*
@@ -92,16 +345,60 @@ void print_array(void *arr, int len, const char *msg, Fetch_Type type)
  */
 void print_matrix(void **matrix, int rows, int cols, const char *msg, Fetch_Type type)
 {
-    printf(BOLD "%s " RESET, msg);
-    printf("{\n");
+    print_matrix_ctx(context_default(), matrix, rows, cols, msg, type);
+}
+
+/*
+ * print_matrix_ctx()
+ * ----------------------
+ * Description:
+ *      print_matrix() on an explicit context, written as one record.
+ */
+void print_matrix_ctx(Utils_Context *ctx, void **matrix, int rows, int cols, const char *msg, Fetch_Type type)
+{
+    if ((unsigned)type > TYPE_DOUBLE)
+    {
+        print_log_ctx(ctx, "[ERROR]", RED, "Unexpected type\n");
+        return;
+    }
+
+    int head, tail;
+    bool elided = print_split(ctx->print.max_rows, rows, &head, &tail);
+    int shown = elided ? head + tail + 1 : rows;
+    int *widths = NULL;
+
+    /* Widths come from the rendered values of the shown rows only. */
+    if (ctx->print.align && rows > 0)
+    {
+        int max = ctx->print.max_elements;
+        int slots = max > 0 && cols > max ? max + 1 : cols;
+
+        widths = context_alloc(ctx, (size_t)(slots > 0 ? slots : 1) * sizeof(int));
+        if (widths != NULL)
+            print_widths(ctx, matrix, rows, cols, type, widths);
+    }
 
-    // Iterate through each row
-    for (int i = 0; i < rows; ++i) 
+    context_begin(ctx, ctx->out);
+
+    print_color(ctx, BOLD);
+    context_append(ctx, "%s ", msg);
+    print_color(ctx, RESET);
+    context_write(ctx, "{\n", 2);
+
+    // Iterate through each shown row
+    for (int pos = 0; pos < shown; ++pos) 
     {
-        print_array(matrix[i], cols, "Row", type);
+        int i = print_shown(pos, rows, head, tail, elided);
+
+        if (i < 0)
+            context_append(ctx, "... (%d rows)\n", rows - head - tail);
+        else
+            print_format(ctx, matrix[i], cols, "Row", type, widths);
     }
 
-    printf("}\n");
+    context_write(ctx, "}\n", 2);
+    context_end(ctx);
+    context_release(ctx, widths);
 }
 
 /*
@@ -111,6 +408,17 @@ void print_matrix(void **matrix, int rows, int cols, const char *msg, Fetch_Type
  *      Prints a progress bar.
  */
 void print_progress_bar(int progress, int total, int width, Char_Type fill_complete, Char_Type fill_remaining)
+{
+    print_progress_bar_ctx(context_default(), progress, total, width, fill_complete, fill_remaining);
+}
+
+/*
+ * print_progress_bar_ctx()
+ * ----------------------
+ * Description:
+ *      print_progress_bar() on an explicit context.
+ */
+void print_progress_bar_ctx(Utils_Context *ctx, int progress, int total, int width, Char_Type fill_complete, Char_Type fill_remaining)
 {
     char fill, empty;
 
@@ -133,33 +441,37 @@ void print_progress_bar(int progress, int total, int width, Char_Type fill_compl
         case TILDE:         empty = '~'; break;
         case HASH:          empty = '#'; break;
         case UNDERSCORE:    empty = '_'; break;
+        default:            empty = ' '; break;
     }
 
     if (total <= 0 || width <= 0) 
     {
-        print_log("[!]", RED, "Total and width must be greater than 0\n");
+        print_log_ctx(ctx, "[!]", RED, "Total and width must be greater than 0\n");
         return;
     }
     else if (progress > total)
     {
-        print_log("[!]", RED, "Progress made cannot be larger than total: [ %d ] > [ %d ]\n", progress, total);
+        print_log_ctx(ctx, "[!]", RED, "Progress made cannot be larger than total: [ %d ] > [ %d ]\n", progress, total);
         return;
     }
 
     float ratio = (float)progress / total;
     int pos = (int)width * ratio;
 
-    printf("[");
+    context_begin(ctx, ctx->out);
+    context_write(ctx, "[", 1);
+
     for (int i = 0; i < width; ++i) 
     {
         if (i < pos) 
-            printf("%c", fill);
+            context_write(ctx, &fill, 1);
         else 
-            printf("%c", empty);
+            context_write(ctx, &empty, 1);
     }
     
-    printf("] %.2f%%\n", ratio * 100);
-    fflush(stdout);
+    context_append(ctx, "] %.2f%%\n", ratio * 100);
+    context_end(ctx);
+    fflush(ctx->out);
 }
 
 /*
@@ -172,16 +484,22 @@ void print_log(const char *prefix, Color color, const char *format, ...)
 {
     va_list args;
     va_start(args, format);
+    print_vlog(context_default(), prefix, color, format, args);
+    va_end(args);
+}
 
-    if (color.fg_color)
-    {
-        fprintf(stderr, "%s%s%s%s" RESET " ", color.fg_color, color.bg_color ? color.bg_color : "", BOLD, prefix);
-        fprintf(stderr, "%s%s", color.fg_color, color.bg_color ? color.bg_color : "");
-    }
-
-    vfprintf(stderr, format, args);
-    fprintf(stderr, RESET);
+/*
+ * print_log_ctx()
+ * ----------------------
+ * Description:
+ *      print_log() on an explicit context.
+ */
+void print_log_ctx(Utils_Context *ctx, const char *prefix, Color color, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    print_vlog(ctx, prefix, color, format, args);
     va_end(args);
 }
 
-/* print_utils.c */
\ No newline at end of file
+/* print_utils.c */
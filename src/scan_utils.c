@@ -0,0 +1,484 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : scan_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at computing prefix sums.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <scan_utils.h>
+#include <cpu_utils.h>
+#include <thread_utils.h>
+
+#ifdef UTILS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/* [ Structs ] */
+
+/* A running sum of any Fetch_Type. */
+typedef union
+{
+    int i;
+    long l;
+    long long ll;
+    float f;
+    double d;
+} Scan_Value;
+
+/* One block of the array, scanned by one thread. */
+typedef struct
+{
+    void *dst;              // the full output
+    const void *src;        // the full input
+    const bool *heads;      // segment heads, NULL for a plain scan
+    int begin;              // first index of the block
+    int end;                // one past its last index
+    int first_head;         // index of its first head, end if none
+    Fetch_Type type;        // type of the elements
+    bool exclusive;         // whether the scan is exclusive
+    bool simd;              // whether the AVX2 kernels may be used
+    bool offset;            // false for the first pass, true for the second
+    Scan_Value total;       // sum of the block after its last head
+    Scan_Value carry;       // sum of everything before the block
+} Scan_Part;
+
+/* [ Kernels ] */
+
+/*
+ * SCAN_DEFINE()
+ * ----------------------
+ * Description:
+ *      Generates the scalar kernels of one type. Sums are kept in ACC,
+ *      the unsigned counterpart of integer types, so they wrap around.
+ *      Every kernel returns the running sum after its last element.
+ */
+#define SCAN_DEFINE(suffix, T, ACC)                                             \
+static T scan_run_##suffix(T *dst, const T *src, int n, bool exclusive, T carry) \
+{                                                                               \
+    ACC acc = (ACC)carry;                                                       \
+                                                                                \
+    if (exclusive)                                                              \
+    {                                                                           \
+        for (int i = 0; i < n; ++i)                                             \
+        {                                                                       \
+            T x = src[i];                                                       \
+            dst[i] = (T)acc;                                                    \
+            acc += (ACC)x;                                                      \
+        }                                                                       \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        for (int i = 0; i < n; ++i)                                             \
+        {                                                                       \
+            acc += (ACC)src[i];                                                 \
+            dst[i] = (T)acc;                                                    \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    return (T)acc;                                                              \
+}                                                                               \
+                                                                                \
+static T scan_segment_##suffix(T *dst, const T *src, const bool *heads, int n, bool exclusive, T carry) \
+{                                                                               \
+    ACC acc = (ACC)carry;                                                       \
+                                                                                \
+    for (int i = 0; i < n; ++i)                                                 \
+    {                                                                           \
+        T x = src[i];                                                           \
+                                                                                \
+        if (heads[i])                                                           \
+            acc = 0;                                                            \
+                                                                                \
+        if (exclusive)                                                          \
+        {                                                                       \
+            dst[i] = (T)acc;                                                    \
+            acc += (ACC)x;                                                      \
+        }                                                                       \
+        else                                                                    \
+        {                                                                       \
+            acc += (ACC)x;                                                      \
+            dst[i] = (T)acc;                                                    \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    return (T)acc;                                                              \
+}                                                                               \
+                                                                                \
+static void scan_add_##suffix(T *dst, int n, T carry)                           \
+{                                                                               \
+    for (int i = 0; i < n; ++i)                                                 \
+        dst[i] = (T)((ACC)dst[i] + (ACC)carry);                                 \
+}
+
+SCAN_DEFINE(int, int, unsigned int)
+SCAN_DEFINE(long, long, unsigned long)
+SCAN_DEFINE(long_long, long long, unsigned long long)
+SCAN_DEFINE(float, float, float)
+SCAN_DEFINE(double, double, double)
+
+#ifdef UTILS_X86_SIMD
+/*
+ * scan_run_int_avx2()
+ * ----------------------
+ * Description:
+ *      Scans eight ints per step: shifted copies of the vector are
+ *      added within each 128-bit half, then the low half's total is
+ *      added to the high half and the running sum to all of them.
+ */
+__attribute__((target("avx2")))
+static int scan_run_int_avx2(int *dst, const int *src, int n, bool exclusive, int carry)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i prev = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+    const __m256i last = _mm256_set1_epi32(7);
+    __m256i sum = _mm256_set1_epi32(carry);
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+        x = _mm256_add_epi32(x, _mm256_shuffle_epi32(_mm256_permute2x128_si256(x, x, 0x08), 0xFF));
+
+        __m256i out = exclusive ? _mm256_blend_epi32(_mm256_permutevar8x32_epi32(x, prev), zero, 0x01) : x;
+
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_add_epi32(out, sum));
+        sum = _mm256_add_epi32(sum, _mm256_permutevar8x32_epi32(x, last));
+    }
+
+    return scan_run_int(dst + i, src + i, n - i, exclusive, _mm_cvtsi128_si32(_mm256_castsi256_si128(sum)));
+}
+
+/*
+ * scan_run_long_long_avx2()
+ * ----------------------
+ * Description:
+ *      scan_run_int_avx2() for four 64-bit integers per step.
+ */
+__attribute__((target("avx2")))
+static long long scan_run_long_long_avx2(long long *dst, const long long *src, int n, bool exclusive, long long carry)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i sum = _mm256_set1_epi64x(carry);
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+
+        x = _mm256_add_epi64(x, _mm256_slli_si256(x, 8));
+        x = _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_permute4x64_epi64(x, 0x50), zero, 0x0F));
+
+        __m256i out = exclusive ? _mm256_blend_epi32(_mm256_permute4x64_epi64(x, 0x90), zero, 0x03) : x;
+
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_add_epi64(out, sum));
+        sum = _mm256_add_epi64(sum, _mm256_permute4x64_epi64(x, 0xFF));
+    }
+
+    return scan_run_long_long(dst + i, src + i, n - i, exclusive, _mm_cvtsi128_si64(_mm256_castsi256_si128(sum)));
+}
+
+/*
+ * scan_run_long_avx2()
+ * ----------------------
+ * Description:
+ *      Scans longs with the kernel of the same width.
+ */
+__attribute__((target("avx2")))
+static long scan_run_long_avx2(long *dst, const long *src, int n, bool exclusive, long carry)
+{
+    if (sizeof(long) == sizeof(long long))
+        return (long)scan_run_long_long_avx2((long long *)dst, (const long long *)src, n, exclusive, carry);
+
+    return (long)scan_run_int_avx2((int *)dst, (const int *)src, n, exclusive, (int)carry);
+}
+
+/*
+ * scan_run_float_avx2()
+ * ----------------------
+ * Description:
+ *      scan_run_int_avx2() for eight floats per step.
+ */
+__attribute__((target("avx2")))
+static float scan_run_float_avx2(float *dst, const float *src, int n, bool exclusive, float carry)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256i prev = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+    const __m256i last = _mm256_set1_epi32(7);
+    __m256 sum = _mm256_set1_ps(carry);
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(src + i);
+
+        x = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 4)));
+        x = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 8)));
+        x = _mm256_add_ps(x, _mm256_permute_ps(_mm256_permute2f128_ps(x, x, 0x08), 0xFF));
+
+        __m256 out = exclusive ? _mm256_blend_ps(_mm256_permutevar8x32_ps(x, prev), zero, 0x01) : x;
+
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(out, sum));
+        sum = _mm256_add_ps(sum, _mm256_permutevar8x32_ps(x, last));
+    }
+
+    return scan_run_float(dst + i, src + i, n - i, exclusive, _mm_cvtss_f32(_mm256_castps256_ps128(sum)));
+}
+
+/*
+ * scan_run_double_avx2()
+ * ----------------------
+ * Description:
+ *      scan_run_int_avx2() for four doubles per step.
+ */
+__attribute__((target("avx2")))
+static double scan_run_double_avx2(double *dst, const double *src, int n, bool exclusive, double carry)
+{
+    const __m256d zero = _mm256_setzero_pd();
+    __m256d sum = _mm256_set1_pd(carry);
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d x = _mm256_loadu_pd(src + i);
+
+        x = _mm256_add_pd(x, _mm256_castsi256_pd(_mm256_slli_si256(_mm256_castpd_si256(x), 8)));
+        x = _mm256_add_pd(x, _mm256_blend_pd(_mm256_permute4x64_pd(x, 0x50), zero, 0x3));
+
+        __m256d out = exclusive ? _mm256_blend_pd(_mm256_permute4x64_pd(x, 0x90), zero, 0x1) : x;
+
+        _mm256_storeu_pd(dst + i, _mm256_add_pd(out, sum));
+        sum = _mm256_add_pd(sum, _mm256_permute4x64_pd(x, 0xFF));
+    }
+
+    return scan_run_double(dst + i, src + i, n - i, exclusive, _mm_cvtsd_f64(_mm256_castpd256_pd128(sum)));
+}
+#endif // UTILS_X86_SIMD
+
+/*
+ * SCAN_PART_DEFINE()
+ * ----------------------
+ * Description:
+ *      Generates the per-block passes of one type. The first pass scans
+ *      the block from zero and records its total; the second adds the
+ *      carry of the blocks before it, up to the block's first head.
+ */
+#ifdef UTILS_X86_SIMD
+#define SCAN_RUN(suffix, part, ...)                                             \
+    ((part)->simd ? scan_run_##suffix##_avx2(__VA_ARGS__) : scan_run_##suffix(__VA_ARGS__))
+#else
+#define SCAN_RUN(suffix, part, ...) scan_run_##suffix(__VA_ARGS__)
+#endif
+
+#define SCAN_PART_DEFINE(suffix, T, ACC, FIELD)                                 \
+static void scan_part_##suffix(Scan_Part *part)                                 \
+{                                                                               \
+    T *dst = (T *)part->dst + part->begin;                                      \
+    const T *src = (const T *)part->src + part->begin;                          \
+    int n = part->end - part->begin;                                            \
+                                                                                \
+    if (part->offset)                                                           \
+        scan_add_##suffix(dst, part->first_head - part->begin, part->carry.FIELD); \
+    else if (part->heads != NULL)                                               \
+        part->total.FIELD = scan_segment_##suffix(dst, src, part->heads + part->begin, n, part->exclusive, 0); \
+    else                                                                        \
+        part->total.FIELD = SCAN_RUN(suffix, part, dst, src, n, part->exclusive, 0); \
+}                                                                               \
+                                                                                \
+static void scan_carry_##suffix(Scan_Part *part, int parts)                     \
+{                                                                               \
+    ACC carry = 0;                                                              \
+                                                                                \
+    for (int p = 0; p < parts; ++p)                                             \
+    {                                                                           \
+        part[p].carry.FIELD = (T)carry;                                         \
+                                                                                \
+        /* A head inside the block cuts off everything before it. */            \
+        if (part[p].first_head < part[p].end)                                   \
+            carry = (ACC)part[p].total.FIELD;                                   \
+        else                                                                    \
+            carry += (ACC)part[p].total.FIELD;                                  \
+    }                                                                           \
+}
+
+SCAN_PART_DEFINE(int, int, unsigned int, i)
+SCAN_PART_DEFINE(long, long, unsigned long, l)
+SCAN_PART_DEFINE(long_long, long long, unsigned long long, ll)
+SCAN_PART_DEFINE(float, float, float, f)
+SCAN_PART_DEFINE(double, double, double, d)
+
+/*
+ * SCAN_DISPATCH()
+ * ----------------------
+ * Description:
+ *      Switches once on the type and calls the typed kernel.
+ */
+#define SCAN_DISPATCH(kernel, type, ...)                                        \
+    switch (type)                                                               \
+    {                                                                           \
+        case TYPE_INT:          kernel##_int(__VA_ARGS__);          break;      \
+        case TYPE_LONG:         kernel##_long(__VA_ARGS__);         break;      \
+        case TYPE_LONG_LONG:    kernel##_long_long(__VA_ARGS__);    break;      \
+        case TYPE_FLOAT:        kernel##_float(__VA_ARGS__);        break;      \
+        case TYPE_DOUBLE:       kernel##_double(__VA_ARGS__);       break;      \
+        default:                break;                                          \
+    }
+
+/* [ Helpers ] */
+
+/*
+ * scan_part()
+ * ----------------------
+ * Description:
+ *      Runs the current pass over one block. Used as the thread
+ *      entry point.
+ */
+static void *scan_part(void *arg)
+{
+    Scan_Part *part = arg;
+
+    SCAN_DISPATCH(scan_part, part->type, part);
+    return NULL;
+}
+
+/*
+ * scan_pass()
+ * ----------------------
+ * Description:
+ *      Runs the current pass over blocks [first, parts), the calling
+ *      thread taking the first one once the others are started.
+ */
+static void scan_pass(Scan_Part *part, int first, int parts)
+{
+    pthread_t tid[SCAN_MAX_THREADS];
+
+    thread_fork_join(scan_part, &part[first], sizeof(*part), parts - first, tid);
+}
+
+/*
+ * scan_threads()
+ * ----------------------
+ * Description:
+ *      Picks how many threads to use for len elements.
+ */
+static int scan_threads(int threads, int len)
+{
+    if (threads <= 0)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (int)online : 1;
+    }
+
+    int most = len / SCAN_PARALLEL_MIN;
+
+    if (most < threads)
+        threads = most > 1 ? most : 1;
+
+    return threads < SCAN_MAX_THREADS ? threads : SCAN_MAX_THREADS;
+}
+
+/*
+ * scan_blocks()
+ * ----------------------
+ * Description:
+ *      Scans in one block per thread: every block is scanned on its own,
+ *      the carries are summed in order, then added to every block but
+ *      the first.
+ */
+static int scan_blocks(void *dst, const void *src, const bool *heads, int len, Fetch_Type type, Scan_Mode mode, int threads)
+{
+    if ((dst == NULL || src == NULL) && len > 0)
+        return -1;
+
+    if (len < 0 || (unsigned)type > TYPE_DOUBLE || (mode != SCAN_INCLUSIVE && mode != SCAN_EXCLUSIVE))
+    {
+        print_log("[ERROR]", RED, "Invalid scan arguments\n");
+        return -1;
+    }
+
+    if (len == 0)
+        return 0;
+
+    Scan_Part part[SCAN_MAX_THREADS];
+    int parts = scan_threads(threads, len);
+    bool simd = false;
+
+#ifdef UTILS_X86_SIMD
+    simd = cpu_tier() >= CPU_TIER_AVX2;
+#endif
+
+    for (int p = 0; p < parts; ++p)
+    {
+        part[p].dst = dst;
+        part[p].src = src;
+        part[p].heads = heads;
+        part[p].begin = (int)((long long)len * p / parts);
+        part[p].end = (int)((long long)len * (p + 1) / parts);
+        part[p].type = type;
+        part[p].exclusive = mode == SCAN_EXCLUSIVE;
+        part[p].simd = simd;
+        part[p].offset = false;
+        part[p].first_head = part[p].end;
+
+        if (heads != NULL)
+        {
+            const bool *head = memchr(heads + part[p].begin, true, (size_t)(part[p].end - part[p].begin));
+
+            if (head != NULL)
+                part[p].first_head = (int)(head - heads);
+        }
+    }
+
+    scan_pass(part, 0, parts);
+
+    if (parts == 1)
+        return 0;
+
+    SCAN_DISPATCH(scan_carry, type, part, parts);
+
+    for (int p = 1; p < parts; ++p)
+        part[p].offset = true;
+
+    scan_pass(part, 1, parts);
+    return 0;
+}
+
+/* [ Functions ] */
+
+/*
+ * scan()
+ * ----------------------
+ * Description:
+ *      Computes the prefix sums of an array.
+ */
+int scan(void *dst, const void *src, int len, Fetch_Type type, Scan_Mode mode, int threads)
+{
+    return scan_blocks(dst, src, NULL, len, type, mode, threads);
+}
+
+/*
+ * scan_segmented()
+ * ----------------------
+ * Description:
+ *      Computes the prefix sums of every segment of an array.
+ */
+int scan_segmented(void *dst, const void *src, const bool *heads, int len, Fetch_Type type, Scan_Mode mode, int threads)
+{
+    if (heads == NULL && len > 0)
+        return -1;
+
+    return scan_blocks(dst, src, heads, len, type, mode, threads);
+}
+
+/* scan_utils.c */
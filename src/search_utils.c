@@ -0,0 +1,548 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : search_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at searching sorted arrays.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <search_utils.h>
+
+/* [ Macros ] */
+
+#define SEARCH_GROUP (16)                       // queries interleaved by the batched searches
+#define SEARCH_LINE(T) (64 / (int)sizeof(T))    // elements per cache line
+
+#ifdef __GNUC__
+#define SEARCH_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define SEARCH_PREFETCH(p) ((void)(p))
+#endif
+
+#define SEARCH_LESS(x, key)     ((x) < (key))
+#define SEARCH_LESS_EQ(x, key)  ((x) <= (key))
+
+/* [ Helpers ] */
+
+/*
+ * search_ctz()
+ * ----------------------
+ * Description:
+ *      Counts the trailing zero bits of a non-zero value.
+ */
+static inline int search_ctz(unsigned x)
+{
+#ifdef __GNUC__
+    return __builtin_ctz(x);
+#else
+    int n = 0;
+
+    while (!(x & 1u))
+    {
+        x >>= 1;
+        n++;
+    }
+
+    return n;
+#endif
+}
+
+/* [ Kernels ] */
+
+/*
+ * SEARCH_BRANCHY()
+ * ----------------------
+ * Description:
+ *      Classic binary search; CMP decides lower or upper bound.
+ */
+#define SEARCH_BRANCHY(name, T, CMP)                                            \
+static int name(const T *a, int n, T key)                                       \
+{                                                                               \
+    int lo = 0, hi = n;                                                         \
+                                                                                \
+    while (lo < hi)                                                             \
+    {                                                                           \
+        int mid = lo + (hi - lo) / 2;                                           \
+                                                                                \
+        if (CMP(a[mid], key))                                                   \
+            lo = mid + 1;                                                       \
+        else                                                                    \
+            hi = mid;                                                           \
+    }                                                                           \
+                                                                                \
+    return lo;                                                                  \
+}
+
+/*
+ * SEARCH_BRANCHLESS()
+ * ----------------------
+ * Description:
+ *      Binary search with a fixed trip count. The answer always lies
+ *      in [base, base + n]; each step halves n and moves base with a
+ *      conditional move. PREFETCH fetches both candidates of the next step.
+ */
+#define SEARCH_BRANCHLESS(name, T, CMP, PREFETCH)                               \
+static int name(const T *a, int n, T key)                                       \
+{                                                                               \
+    const T *base = a;                                                          \
+                                                                                \
+    if (n <= 0)                                                                 \
+        return 0;                                                               \
+                                                                                \
+    while (n > 1)                                                               \
+    {                                                                           \
+        int half = n / 2;                                                       \
+                                                                                \
+        if (PREFETCH)                                                           \
+        {                                                                       \
+            int next = (n - half) / 2;                                          \
+            SEARCH_PREFETCH(base + next);                                       \
+            SEARCH_PREFETCH(base + half + next);                                \
+        }                                                                       \
+                                                                                \
+        base = CMP(base[half], key) ? base + half : base;                       \
+        n -= half;                                                              \
+    }                                                                           \
+                                                                                \
+    return (int)(base - a) + CMP(*base, key);                                   \
+}
+
+/*
+ * SEARCH_BATCH()
+ * ----------------------
+ * Description:
+ *      Branchless lower bound over a group of keys at once. Every query
+ *      shares the same trip count, so they advance in lockstep and each
+ *      one prefetches its next probe while the others are compared.
+ */
+#define SEARCH_BATCH(name, T)                                                   \
+static void name(const T *a, int n, const T *keys, int cnt, int *out)           \
+{                                                                               \
+    const T *base[SEARCH_GROUP];                                                \
+                                                                                \
+    for (int q = 0; q < cnt; q += SEARCH_GROUP)                                 \
+    {                                                                           \
+        int group = cnt - q < SEARCH_GROUP ? cnt - q : SEARCH_GROUP;            \
+        const T *key = keys + q;                                                \
+        int len = n;                                                            \
+                                                                                \
+        if (n <= 0)                                                             \
+        {                                                                       \
+            for (int g = 0; g < group; ++g)                                     \
+                out[q + g] = 0;                                                 \
+            continue;                                                           \
+        }                                                                       \
+                                                                                \
+        for (int g = 0; g < group; ++g)                                         \
+            base[g] = a;                                                        \
+                                                                                \
+        while (len > 1)                                                         \
+        {                                                                       \
+            int half = len / 2;                                                 \
+            int next = (len - half) / 2;                                        \
+                                                                                \
+            for (int g = 0; g < group; ++g)                                     \
+            {                                                                   \
+                base[g] = base[g][half] < key[g] ? base[g] + half : base[g];    \
+                SEARCH_PREFETCH(base[g] + next);                                \
+            }                                                                   \
+                                                                                \
+            len -= half;                                                        \
+        }                                                                       \
+                                                                                \
+        for (int g = 0; g < group; ++g)                                         \
+            out[q + g] = (int)(base[g] - a) + (*base[g] < key[g]);              \
+    }                                                                           \
+}
+
+/*
+ * SEARCH_EYTZINGER()
+ * ----------------------
+ * Description:
+ *      Descends the BFS layout: the children of slot k are 2k and 2k + 1,
+ *      so the descendants four levels down share one cache line and are
+ *      prefetched early. Once past a leaf, the trailing one bits of k tell
+ *      how many right turns to undo to reach the answer.
+ */
+#define SEARCH_EYTZINGER(name, T, CMP)                                          \
+static int name(const T *b, const int *ranks, int n, T key)                     \
+{                                                                               \
+    unsigned k = 1;                                                             \
+                                                                                \
+    while (k <= (unsigned)n)                                                    \
+    {                                                                           \
+        SEARCH_PREFETCH(b + k * SEARCH_LINE(T));                                \
+        k = 2 * k + CMP(b[k], key);                                             \
+    }                                                                           \
+                                                                                \
+    k >>= search_ctz(~k) + 1;                                                   \
+    return k ? ranks[k] : n;                                                    \
+}
+
+/*
+ * SEARCH_EYTZINGER_BATCH()
+ * ----------------------
+ * Description:
+ *      Interleaved Eytzinger lower bound over a group of keys.
+ */
+#define SEARCH_EYTZINGER_BATCH(name, T)                                         \
+static void name(const T *b, const int *ranks, int n, const T *keys, int cnt, int *out) \
+{                                                                               \
+    unsigned k[SEARCH_GROUP];                                                   \
+    int depth = 0;                                                              \
+                                                                                \
+    while ((1u << depth) <= (unsigned)n)                                        \
+        depth++;                                                                \
+                                                                                \
+    for (int q = 0; q < cnt; q += SEARCH_GROUP)                                 \
+    {                                                                           \
+        int group = cnt - q < SEARCH_GROUP ? cnt - q : SEARCH_GROUP;            \
+        const T *key = keys + q;                                                \
+                                                                                \
+        for (int g = 0; g < group; ++g)                                         \
+            k[g] = 1;                                                           \
+                                                                                \
+        for (int d = 0; d < depth; ++d)                                         \
+        {                                                                       \
+            for (int g = 0; g < group; ++g)                                     \
+            {                                                                   \
+                if (k[g] <= (unsigned)n)                                        \
+                {                                                               \
+                    k[g] = 2 * k[g] + (b[k[g]] < key[g]);                       \
+                    SEARCH_PREFETCH(b + k[g] * SEARCH_LINE(T));                 \
+                }                                                               \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        for (int g = 0; g < group; ++g)                                         \
+        {                                                                       \
+            unsigned slot = k[g] >> (search_ctz(~k[g]) + 1);                    \
+            out[q + g] = slot ? ranks[slot] : n;                                \
+        }                                                                       \
+    }                                                                           \
+}
+
+/*
+ * SEARCH_DEFINE()
+ * ----------------------
+ * Description:
+ *      Instantiates every search kernel for one element type.
+ */
+#define SEARCH_DEFINE(suffix, T)                                                        \
+    SEARCH_BRANCHY(search_lower_##suffix, T, SEARCH_LESS)                               \
+    SEARCH_BRANCHY(search_upper_##suffix, T, SEARCH_LESS_EQ)                            \
+    SEARCH_BRANCHLESS(search_lower_branchless_##suffix, T, SEARCH_LESS, false)          \
+    SEARCH_BRANCHLESS(search_upper_branchless_##suffix, T, SEARCH_LESS_EQ, false)       \
+    SEARCH_BRANCHLESS(search_lower_prefetch_##suffix, T, SEARCH_LESS, true)             \
+    SEARCH_BATCH(search_lower_batch_##suffix, T)                                        \
+    SEARCH_EYTZINGER(search_eytz_lower_##suffix, T, SEARCH_LESS)                        \
+    SEARCH_EYTZINGER(search_eytz_upper_##suffix, T, SEARCH_LESS_EQ)                     \
+    SEARCH_EYTZINGER_BATCH(search_eytz_batch_##suffix, T)
+
+SEARCH_DEFINE(int, int)
+SEARCH_DEFINE(long, long)
+SEARCH_DEFINE(long_long, long long)
+SEARCH_DEFINE(float, float)
+SEARCH_DEFINE(double, double)
+
+/*
+ * SEARCH_DISPATCH()
+ * ----------------------
+ * Description:
+ *      Switches once on the type and returns the typed kernel's result.
+ */
+#define SEARCH_DISPATCH(kernel, type, arr, len, key)                                                \
+    switch (type)                                                                                   \
+    {                                                                                               \
+        case TYPE_INT:          return kernel##_int(arr, len, *(const int *)(key));                 \
+        case TYPE_LONG:         return kernel##_long(arr, len, *(const long *)(key));               \
+        case TYPE_LONG_LONG:    return kernel##_long_long(arr, len, *(const long long *)(key));     \
+        case TYPE_FLOAT:        return kernel##_float(arr, len, *(const float *)(key));             \
+        case TYPE_DOUBLE:       return kernel##_double(arr, len, *(const double *)(key));           \
+        default:                return -1;                                                          \
+    }
+
+/*
+ * search_valid()
+ * ----------------------
+ * Description:
+ *      Checks the arguments shared by every search.
+ */
+static inline bool search_valid(const void *arr, int len, Fetch_Type type, const void *key)
+{
+    return (arr != NULL || len == 0) && len >= 0 && key != NULL && (unsigned)type <= TYPE_DOUBLE;
+}
+
+/* [ Functions ] */
+
+/*
+ * search_lower_bound()
+ * ----------------------
+ * Description:
+ *      Finds the first element not less than the key.
+ */
+int search_lower_bound(const void *arr, int len, Fetch_Type type, const void *key)
+{
+    if (!search_valid(arr, len, type, key))
+        return -1;
+
+    SEARCH_DISPATCH(search_lower, type, arr, len, key);
+}
+
+/*
+ * search_upper_bound()
+ * ----------------------
+ * Description:
+ *      Finds the first element greater than the key.
+ */
+int search_upper_bound(const void *arr, int len, Fetch_Type type, const void *key)
+{
+    if (!search_valid(arr, len, type, key))
+        return -1;
+
+    SEARCH_DISPATCH(search_upper, type, arr, len, key);
+}
+
+/*
+ * search_equal_range()
+ * ----------------------
+ * Description:
+ *      Finds the range of elements equal to the key.
+ */
+int search_equal_range(const void *arr, int len, Fetch_Type type, const void *key, int *first, int *last)
+{
+    if (first == NULL || last == NULL)
+        return -1;
+
+    *first = search_lower_bound_branchless(arr, len, type, key);
+    if (*first < 0)
+        return -1;
+
+    /* The upper bound can only lie at or past the lower bound. */
+    const char *rest = (const char *)arr + (size_t)*first * type_sizes[type];
+    *last = *first + search_upper_bound_branchless(rest, len - *first, type, key);
+
+    return *last - *first;
+}
+
+/*
+ * search_lower_bound_branchless()
+ * ----------------------
+ * Description:
+ *      Branchless lower bound.
+ */
+int search_lower_bound_branchless(const void *arr, int len, Fetch_Type type, const void *key)
+{
+    if (!search_valid(arr, len, type, key))
+        return -1;
+
+    SEARCH_DISPATCH(search_lower_branchless, type, arr, len, key);
+}
+
+/*
+ * search_upper_bound_branchless()
+ * ----------------------
+ * Description:
+ *      Branchless upper bound.
+ */
+int search_upper_bound_branchless(const void *arr, int len, Fetch_Type type, const void *key)
+{
+    if (!search_valid(arr, len, type, key))
+        return -1;
+
+    SEARCH_DISPATCH(search_upper_branchless, type, arr, len, key);
+}
+
+/*
+ * search_lower_bound_prefetch()
+ * ----------------------
+ * Description:
+ *      Branchless lower bound with prefetching.
+ */
+int search_lower_bound_prefetch(const void *arr, int len, Fetch_Type type, const void *key)
+{
+    if (!search_valid(arr, len, type, key))
+        return -1;
+
+    SEARCH_DISPATCH(search_lower_prefetch, type, arr, len, key);
+}
+
+/*
+ * search_lower_bound_batch()
+ * ----------------------
+ * Description:
+ *      Runs many interleaved lower bound queries.
+ */
+int search_lower_bound_batch(const void *arr, int len, Fetch_Type type, const void *keys, int key_cnt, int *out)
+{
+    if (!search_valid(arr, len, type, keys) || key_cnt < 0 || out == NULL)
+        return -1;
+
+    switch (type)
+    {
+        case TYPE_INT:          search_lower_batch_int(arr, len, keys, key_cnt, out);          break;
+        case TYPE_LONG:         search_lower_batch_long(arr, len, keys, key_cnt, out);         break;
+        case TYPE_LONG_LONG:    search_lower_batch_long_long(arr, len, keys, key_cnt, out);    break;
+        case TYPE_FLOAT:        search_lower_batch_float(arr, len, keys, key_cnt, out);        break;
+        case TYPE_DOUBLE:       search_lower_batch_double(arr, len, keys, key_cnt, out);       break;
+        default:                return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * search_index_fill()
+ * ----------------------
+ * Description:
+ *      Copies the sorted array into BFS order with an in-order walk
+ *      of the implicit tree, returning the next sorted position.
+ */
+static int search_index_fill(Search_Index *index, const char *src, size_t size, int pos, unsigned k)
+{
+    if (k <= (unsigned)index->len)
+    {
+        pos = search_index_fill(index, src, size, pos, 2 * k);
+
+        memcpy((char *)index->data + k * size, src + (size_t)pos * size, size);
+        index->ranks[k] = pos++;
+
+        pos = search_index_fill(index, src, size, pos, 2 * k + 1);
+    }
+
+    return pos;
+}
+
+/*
+ * search_index_build()
+ * ----------------------
+ * Description:
+ *      Builds an Eytzinger index from a sorted array.
+ */
+int search_index_build(Search_Index *index, const void *arr, int len, Fetch_Type type)
+{
+    if (index == NULL || (arr == NULL && len != 0) || len < 0 || (unsigned)type > TYPE_DOUBLE)
+        return -1;
+
+    size_t size = type_sizes[type];
+
+    /* Cache-line aligned so the prefetched descendants share one line. */
+    size_t bytes = ((size_t)(len + 1) * size + 63) & ~(size_t)63;
+
+    index->data = aligned_alloc(64, bytes);
+    index->ranks = malloc((size_t)(len + 1) * sizeof(int));
+    index->len = len;
+    index->type = type;
+
+    if (index->data == NULL || index->ranks == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for search index\n");
+        search_index_free(index);
+        return -1;
+    }
+
+    search_index_fill(index, arr, size, 0, 1);
+    return 0;
+}
+
+/*
+ * SEARCH_INDEX_DISPATCH()
+ * ----------------------
+ * Description:
+ *      Switches once on the index type and returns the typed kernel's result.
+ */
+#define SEARCH_INDEX_DISPATCH(kernel, index, key)                                                                       \
+    switch ((index)->type)                                                                                              \
+    {                                                                                                                   \
+        case TYPE_INT:          return kernel##_int((index)->data, (index)->ranks, (index)->len, *(const int *)(key)); \
+        case TYPE_LONG:         return kernel##_long((index)->data, (index)->ranks, (index)->len, *(const long *)(key)); \
+        case TYPE_LONG_LONG:    return kernel##_long_long((index)->data, (index)->ranks, (index)->len, *(const long long *)(key)); \
+        case TYPE_FLOAT:        return kernel##_float((index)->data, (index)->ranks, (index)->len, *(const float *)(key)); \
+        case TYPE_DOUBLE:       return kernel##_double((index)->data, (index)->ranks, (index)->len, *(const double *)(key)); \
+        default:                return -1;                                                                              \
+    }
+
+/*
+ * search_index_lower_bound()
+ * ----------------------
+ * Description:
+ *      Finds the first element not less than the key.
+ */
+int search_index_lower_bound(const Search_Index *index, const void *key)
+{
+    if (index == NULL || index->data == NULL || key == NULL)
+        return -1;
+
+    SEARCH_INDEX_DISPATCH(search_eytz_lower, index, key);
+}
+
+/*
+ * search_index_upper_bound()
+ * ----------------------
+ * Description:
+ *      Finds the first element greater than the key.
+ */
+int search_index_upper_bound(const Search_Index *index, const void *key)
+{
+    if (index == NULL || index->data == NULL || key == NULL)
+        return -1;
+
+    SEARCH_INDEX_DISPATCH(search_eytz_upper, index, key);
+}
+
+/*
+ * search_index_lower_bound_batch()
+ * ----------------------
+ * Description:
+ *      Runs many interleaved lower bound queries against an index.
+ */
+int search_index_lower_bound_batch(const Search_Index *index, const void *keys, int key_cnt, int *out)
+{
+    if (index == NULL || index->data == NULL || keys == NULL || key_cnt < 0 || out == NULL)
+        return -1;
+
+    const void *b = index->data;
+    const int *ranks = index->ranks;
+    int n = index->len;
+
+    switch (index->type)
+    {
+        case TYPE_INT:          search_eytz_batch_int(b, ranks, n, keys, key_cnt, out);        break;
+        case TYPE_LONG:         search_eytz_batch_long(b, ranks, n, keys, key_cnt, out);       break;
+        case TYPE_LONG_LONG:    search_eytz_batch_long_long(b, ranks, n, keys, key_cnt, out);  break;
+        case TYPE_FLOAT:        search_eytz_batch_float(b, ranks, n, keys, key_cnt, out);      break;
+        case TYPE_DOUBLE:       search_eytz_batch_double(b, ranks, n, keys, key_cnt, out);     break;
+        default:                return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * search_index_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by an index.
+ */
+void search_index_free(Search_Index *index)
+{
+    if (index == NULL)
+        return;
+
+    free(index->data);
+    free(index->ranks);
+
+    index->data = NULL;
+    index->ranks = NULL;
+    index->len = 0;
+}
+
+/* search_utils.c */
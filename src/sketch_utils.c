@@ -0,0 +1,666 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : sketch_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at summarizing streams in bounded memory.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <sketch_utils.h>
+#include <convert_utils.h>
+#include <hash_utils.h>
+#include <sort_template.h>
+#include <math.h>
+#include <stdatomic.h>
+
+/* [ Macros ] */
+
+#define SKETCH_CHUNK (256)  // values widened to double at a time
+#define SKETCH_GOLDEN (0x9e3779b97f4a7c15ULL)
+
+/* [ Structs ] */
+
+/* A value of a quantile sketch with the number of values it stands for. */
+typedef struct
+{
+    double value;
+    long long weight;
+} Sketch_Pair;
+
+/* [ Kernels ] */
+
+#define SKETCH_LESS(a, b) ((a) < (b))
+#define SKETCH_PAIR_LESS(a, b) ((a).value < (b).value)
+
+SORT_DEFINE(sketch_values, double, SKETCH_LESS)
+SORT_DEFINE(sketch_pairs, Sketch_Pair, SKETCH_PAIR_LESS)
+
+/* [ Variables ] */
+
+static atomic_ullong sketch_instances = 0;  // quantile sketches created so far, to seed each differently
+
+/* [ Helpers ] */
+
+/*
+ * sketch_coin()
+ * ----------------------
+ * Description:
+ *      Draws 64 random bits from the sketch's xorshift state.
+ */
+static inline uint64_t sketch_coin(Sketch_Kll *sketch)
+{
+    uint64_t x = sketch->seed;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    sketch->seed = x;
+    return x;
+}
+
+/*
+ * sketch_kll_widths()
+ * ----------------------
+ * Description:
+ *      Sets the capacity of every level: k for the top one,
+ *      2/3 of the one above for the others.
+ */
+static void sketch_kll_widths(Sketch_Kll *sketch)
+{
+    double width = sketch->k;
+
+    for (int h = sketch->levels - 1; h >= 0; --h)
+    {
+        int w = (int)ceil(width);
+
+        sketch->widths[h] = w > SKETCH_KLL_MIN_K ? w : SKETCH_KLL_MIN_K;
+        width *= 2.0 / 3.0;
+    }
+}
+
+/*
+ * sketch_kll_reserve()
+ * ----------------------
+ * Description:
+ *      Grows a level to hold need values.
+ */
+static int sketch_kll_reserve(Sketch_Kll *sketch, int h, int need)
+{
+    if (need <= sketch->sizes[h])
+        return 0;
+
+    int size = sketch->sizes[h] * 2 > need ? sketch->sizes[h] * 2 : need;
+
+    double *items = realloc(sketch->items[h], (size_t)size * sizeof(double));
+    if (items == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for sketch level %d\n", h);
+        return -1;
+    }
+
+    sketch->items[h] = items;
+    sketch->sizes[h] = size;
+    return 0;
+}
+
+/*
+ * sketch_kll_compact()
+ * ----------------------
+ * Description:
+ *      Sorts a level and promotes every other value to the
+ *      next one. An odd value out, picked at random, stays.
+ */
+static int sketch_kll_compact(Sketch_Kll *sketch, int h)
+{
+    if (h + 1 == sketch->levels)
+    {
+        sketch->levels++;
+        sketch_kll_widths(sketch);
+    }
+
+    int len = sketch->lens[h];
+    int keep = len & 1;
+    int pairs = len / 2;
+
+    if (sketch_kll_reserve(sketch, h + 1, sketch->lens[h + 1] + pairs) != 0)
+        return -1;
+
+    double *items = sketch->items[h];
+    double *up = sketch->items[h + 1] + sketch->lens[h + 1];
+
+    if (keep)
+    {
+        int held = (int)(sketch_coin(sketch) % (uint64_t)len);
+        double tmp = items[held];
+
+        items[held] = items[len - 1];
+        items[len - 1] = tmp;
+    }
+
+    sketch_values_sort(items, len - keep);
+
+    /* Either the even or the odd positions go up, each now counting twice. */
+    int offset = (int)(sketch_coin(sketch) >> 63);
+
+    for (int i = 0; i < pairs; ++i)
+        up[i] = items[2 * i + offset];
+
+    sketch->lens[h + 1] += pairs;
+    sketch->lens[h] = keep;
+
+    if (keep)
+        items[0] = items[len - 1];
+
+    return 0;
+}
+
+/*
+ * sketch_kll_settle()
+ * ----------------------
+ * Description:
+ *      While the sketch holds more values than the sum of the
+ *      level capacities, compacts the lowest full level. Waiting
+ *      for the whole sketch to fill keeps levels larger, and the
+ *      sketch more accurate, than compacting each level as soon
+ *      as it fills.
+ */
+static int sketch_kll_settle(Sketch_Kll *sketch)
+{
+    for (;;)
+    {
+        int retained = 0, capacity = 0, full = -1;
+
+        for (int h = 0; h < sketch->levels; ++h)
+        {
+            retained += sketch->lens[h];
+            capacity += sketch->widths[h];
+
+            if (full < 0 && sketch->lens[h] >= sketch->widths[h] && h + 1 < SKETCH_KLL_LEVELS)
+                full = h;
+        }
+
+        if (retained < capacity || full < 0)
+            return 0;
+
+        if (sketch_kll_compact(sketch, full) != 0)
+            return -1;
+    }
+}
+
+/*
+ * sketch_kll_push()
+ * ----------------------
+ * Description:
+ *      Adds a value that is known not to be NaN.
+ */
+static inline int sketch_kll_push(Sketch_Kll *sketch, double value)
+{
+    if (sketch->lens[0] == sketch->sizes[0] && sketch_kll_reserve(sketch, 0, sketch->lens[0] + 1) != 0)
+        return -1;
+
+    sketch->items[0][sketch->lens[0]++] = value;
+    sketch->n++;
+    sketch->min = value < sketch->min ? value : sketch->min;
+    sketch->max = value > sketch->max ? value : sketch->max;
+
+    if (sketch->lens[0] >= sketch->widths[0])
+        return sketch_kll_settle(sketch);
+
+    return 0;
+}
+
+/*
+ * sketch_kll_valid()
+ * ----------------------
+ * Description:
+ *      Checks that a quantile sketch was initialized.
+ */
+static inline bool sketch_kll_valid(const Sketch_Kll *sketch)
+{
+    return sketch != NULL && sketch->levels > 0;
+}
+
+/*
+ * sketch_hll_valid()
+ * ----------------------
+ * Description:
+ *      Checks that a distinct counter was initialized.
+ */
+static inline bool sketch_hll_valid(const Sketch_Hll *sketch)
+{
+    return sketch != NULL && sketch->registers != NULL;
+}
+
+/*
+ * Hashed bits of a value: integers by their value, floats by the bits
+ * of their double value once 0.0, -0.0 and the NaNs are normalized.
+ */
+static inline uint64_t sketch_bits_integer(long long x)
+{
+    return (uint64_t)x;
+}
+
+static inline uint64_t sketch_bits_real(double x)
+{
+    uint64_t bits;
+
+    x = x == 0.0 ? 0.0 : isnan(x) ? (double)NAN : x;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+/*
+ * SKETCH_HLL_DEFINE()
+ * ----------------------
+ * Description:
+ *      Generates the loop adding an array of one type to a
+ *      distinct counter.
+ */
+#define SKETCH_HLL_DEFINE(suffix, T, BITS)                                      \
+static void sketch_hll_add_##suffix(Sketch_Hll *sketch, const T *values, int len) \
+{                                                                               \
+    int p = sketch->p;                                                          \
+                                                                                \
+    for (int i = 0; i < len; ++i)                                               \
+    {                                                                           \
+        uint64_t h = hash_mix64(BITS(values[i]));                               \
+        uint64_t rest = (h << p) | (1ULL << (p - 1));                           \
+        uint8_t rho = (uint8_t)(__builtin_clzll(rest) + 1);                     \
+        uint8_t *reg = &sketch->registers[h >> (64 - p)];                       \
+                                                                                \
+        *reg = rho > *reg ? rho : *reg;                                         \
+    }                                                                           \
+}
+
+SKETCH_HLL_DEFINE(int, int, sketch_bits_integer)
+SKETCH_HLL_DEFINE(long, long, sketch_bits_integer)
+SKETCH_HLL_DEFINE(long_long, long long, sketch_bits_integer)
+SKETCH_HLL_DEFINE(float, float, sketch_bits_real)
+SKETCH_HLL_DEFINE(double, double, sketch_bits_real)
+
+/* [ Functions ] */
+
+/*
+ * sketch_kll_init()
+ * ----------------------
+ * Description:
+ *      Creates an empty quantile sketch.
+ */
+int sketch_kll_init(Sketch_Kll *sketch, int k)
+{
+    if (sketch == NULL || k < 0 || (k > 0 && k < SKETCH_KLL_MIN_K) || k > (1 << 20))
+        return -1;
+
+    memset(sketch, 0, sizeof(*sketch));
+    sketch->k = k > 0 ? k : SKETCH_KLL_DEFAULT_K;
+    sketch->levels = 1;
+    sketch->min = INFINITY;
+    sketch->max = -INFINITY;
+
+    /*
+     * Every sketch flips its own coins: sketches filled apart and merged
+     * later must not drop the same halves, or their errors add up
+     * instead of cancelling. xorshift needs a nonzero state.
+     */
+    uint64_t instance = atomic_fetch_add(&sketch_instances, 1);
+    sketch->seed = hash_mix64((instance + 1) * SKETCH_GOLDEN ^ (uint64_t)(uintptr_t)sketch) | 1;
+    sketch_kll_widths(sketch);
+
+    if (sketch_kll_reserve(sketch, 0, sketch->k) != 0)
+    {
+        sketch->levels = 0;
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * sketch_kll_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a quantile sketch.
+ */
+void sketch_kll_free(Sketch_Kll *sketch)
+{
+    if (sketch == NULL)
+        return;
+
+    for (int h = 0; h < SKETCH_KLL_LEVELS; ++h)
+        free(sketch->items[h]);
+
+    memset(sketch, 0, sizeof(*sketch));
+}
+
+/*
+ * sketch_kll_update()
+ * ----------------------
+ * Description:
+ *      Adds one value to a quantile sketch.
+ */
+int sketch_kll_update(Sketch_Kll *sketch, double value)
+{
+    if (!sketch_kll_valid(sketch))
+        return -1;
+
+    return isnan(value) ? 0 : sketch_kll_push(sketch, value);
+}
+
+/*
+ * sketch_kll_add()
+ * ----------------------
+ * Description:
+ *      Adds an array of any type to a quantile sketch.
+ */
+int sketch_kll_add(Sketch_Kll *sketch, const void *values, int len, Fetch_Type type)
+{
+    if (!sketch_kll_valid(sketch) || len < 0 || (values == NULL && len > 0) || (unsigned)type > TYPE_DOUBLE)
+        return -1;
+
+    double buf[SKETCH_CHUNK];
+    const char *src = values;
+
+    for (int done = 0; done < len; done += SKETCH_CHUNK)
+    {
+        int n = len - done < SKETCH_CHUNK ? len - done : SKETCH_CHUNK;
+        const double *chunk = (const double *)(const void *)src;
+
+        if (type != TYPE_DOUBLE)
+        {
+            convert_array(buf, TYPE_DOUBLE, src, type, n, CONVERT_CAST);
+            chunk = buf;
+        }
+
+        for (int i = 0; i < n; ++i)
+        {
+            if (!isnan(chunk[i]) && sketch_kll_push(sketch, chunk[i]) != 0)
+                return -1;
+        }
+
+        src += (size_t)n * type_sizes[type];
+    }
+
+    return 0;
+}
+
+/*
+ * sketch_kll_merge()
+ * ----------------------
+ * Description:
+ *      Adds one quantile sketch to another.
+ */
+int sketch_kll_merge(Sketch_Kll *dst, const Sketch_Kll *src)
+{
+    if (!sketch_kll_valid(dst) || !sketch_kll_valid(src) || dst == src)
+        return -1;
+
+    /* Values keep their level, and so the weight they stand for. */
+    for (int h = 0; h < src->levels; ++h)
+    {
+        /* An empty level may have no buffer on either side. */
+        if (src->lens[h] == 0)
+            continue;
+
+        if (sketch_kll_reserve(dst, h, dst->lens[h] + src->lens[h]) != 0)
+            return -1;
+
+        memcpy(dst->items[h] + dst->lens[h], src->items[h], (size_t)src->lens[h] * sizeof(double));
+        dst->lens[h] += src->lens[h];
+    }
+
+    if (src->levels > dst->levels)
+    {
+        dst->levels = src->levels;
+        sketch_kll_widths(dst);
+    }
+
+    dst->n += src->n;
+    dst->min = src->min < dst->min ? src->min : dst->min;
+    dst->max = src->max > dst->max ? src->max : dst->max;
+
+    return sketch_kll_settle(dst);
+}
+
+/*
+ * sketch_kll_quantiles()
+ * ----------------------
+ * Description:
+ *      Estimates several quantiles at once.
+ */
+int sketch_kll_quantiles(const Sketch_Kll *sketch, const double *qs, int count, double *out)
+{
+    if (!sketch_kll_valid(sketch) || sketch->n == 0 || qs == NULL || out == NULL || count < 0)
+        return -1;
+
+    int total = 0;
+
+    for (int h = 0; h < sketch->levels; ++h)
+        total += sketch->lens[h];
+
+    Sketch_Pair *pairs = malloc((size_t)total * sizeof(Sketch_Pair));
+    if (pairs == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for sketch quantiles\n");
+        return -1;
+    }
+
+    int n = 0;
+
+    for (int h = 0; h < sketch->levels; ++h)
+    {
+        for (int i = 0; i < sketch->lens[h]; ++i)
+        {
+            pairs[n].value = sketch->items[h][i];
+            pairs[n].weight = 1LL << h;
+            n++;
+        }
+    }
+
+    sketch_pairs_sort(pairs, n);
+
+    /* Weights become running totals; the last one is sketch->n. */
+    for (int i = 1; i < n; ++i)
+        pairs[i].weight += pairs[i - 1].weight;
+
+    for (int j = 0; j < count; ++j)
+    {
+        double q = qs[j];
+
+        if (!(q > 0.0))
+        {
+            out[j] = isnan(q) ? (double)NAN : sketch->min;
+            continue;
+        }
+
+        if (q >= 1.0)
+        {
+            out[j] = sketch->max;
+            continue;
+        }
+
+        /* First value whose running total reaches q * n. */
+        double target = q * (double)sketch->n;
+        int lo = 0, hi = n - 1;
+
+        while (lo < hi)
+        {
+            int mid = lo + (hi - lo) / 2;
+
+            if ((double)pairs[mid].weight < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        out[j] = pairs[lo].value;
+    }
+
+    free(pairs);
+    return 0;
+}
+
+/*
+ * sketch_kll_quantile()
+ * ----------------------
+ * Description:
+ *      Estimates one quantile.
+ */
+double sketch_kll_quantile(const Sketch_Kll *sketch, double q)
+{
+    double value;
+
+    return sketch_kll_quantiles(sketch, &q, 1, &value) == 0 ? value : (double)NAN;
+}
+
+/*
+ * sketch_kll_rank()
+ * ----------------------
+ * Description:
+ *      Estimates the fraction of values not greater than a value.
+ */
+double sketch_kll_rank(const Sketch_Kll *sketch, double value)
+{
+    if (!sketch_kll_valid(sketch) || sketch->n == 0)
+        return NAN;
+
+    long long below = 0;
+
+    for (int h = 0; h < sketch->levels; ++h)
+    {
+        long long count = 0;
+
+        for (int i = 0; i < sketch->lens[h]; ++i)
+            count += sketch->items[h][i] <= value;
+
+        below += count << h;
+    }
+
+    return (double)below / (double)sketch->n;
+}
+
+/*
+ * sketch_hll_init()
+ * ----------------------
+ * Description:
+ *      Creates an empty distinct counter.
+ */
+int sketch_hll_init(Sketch_Hll *sketch, int p)
+{
+    if (sketch == NULL || (p != 0 && (p < SKETCH_HLL_MIN_P || p > SKETCH_HLL_MAX_P)))
+        return -1;
+
+    sketch->p = p != 0 ? p : SKETCH_HLL_DEFAULT_P;
+    sketch->registers = calloc((size_t)1 << sketch->p, 1);
+
+    if (sketch->registers == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for distinct counter\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * sketch_hll_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a distinct counter.
+ */
+void sketch_hll_free(Sketch_Hll *sketch)
+{
+    if (sketch == NULL)
+        return;
+
+    free(sketch->registers);
+    sketch->registers = NULL;
+    sketch->p = 0;
+}
+
+/*
+ * sketch_hll_add()
+ * ----------------------
+ * Description:
+ *      Adds an array of any type to a distinct counter.
+ */
+int sketch_hll_add(Sketch_Hll *sketch, const void *values, int len, Fetch_Type type)
+{
+    if (!sketch_hll_valid(sketch) || len < 0 || (values == NULL && len > 0))
+        return -1;
+
+    switch (type)
+    {
+        case TYPE_INT:          sketch_hll_add_int(sketch, values, len);        return 0;
+        case TYPE_LONG:         sketch_hll_add_long(sketch, values, len);       return 0;
+        case TYPE_LONG_LONG:    sketch_hll_add_long_long(sketch, values, len);  return 0;
+        case TYPE_FLOAT:        sketch_hll_add_float(sketch, values, len);      return 0;
+        case TYPE_DOUBLE:       sketch_hll_add_double(sketch, values, len);     return 0;
+        default:                return -1;
+    }
+}
+
+/*
+ * sketch_hll_merge()
+ * ----------------------
+ * Description:
+ *      Adds one distinct counter to another.
+ */
+int sketch_hll_merge(Sketch_Hll *dst, const Sketch_Hll *src)
+{
+    if (!sketch_hll_valid(dst) || !sketch_hll_valid(src))
+        return -1;
+
+    if (dst->p != src->p)
+    {
+        print_log("[ERROR]", RED, "Cannot merge distinct counters of precision %d and %d\n", dst->p, src->p);
+        return -1;
+    }
+
+    size_t m = (size_t)1 << dst->p;
+
+    for (size_t i = 0; i < m; ++i)
+        dst->registers[i] = src->registers[i] > dst->registers[i] ? src->registers[i] : dst->registers[i];
+
+    return 0;
+}
+
+/*
+ * sketch_hll_count()
+ * ----------------------
+ * Description:
+ *      Estimates the number of distinct values.
+ */
+double sketch_hll_count(const Sketch_Hll *sketch)
+{
+    if (!sketch_hll_valid(sketch))
+        return -1;
+
+    size_t m = (size_t)1 << sketch->p;
+    double sum = 0.0;
+    size_t zeros = 0;
+
+    for (size_t i = 0; i < m; ++i)
+    {
+        sum += ldexp(1.0, -sketch->registers[i]);
+        zeros += sketch->registers[i] == 0;
+    }
+
+    double alpha = m == 16 ? 0.673 : m == 32 ? 0.697 : m == 64 ? 0.709 : 0.7213 / (1.0 + 1.079 / (double)m);
+    double estimate = alpha * (double)m * (double)m / sum;
+
+    /* Few values leave registers empty; linear counting is better there. */
+    if (estimate <= 2.5 * (double)m && zeros > 0)
+        estimate = (double)m * log((double)m / (double)zeros);
+
+    return estimate;
+}
+
+/* sketch_utils.c */
@@ -17,6 +17,20 @@
 /* [ Headers ] */
 #include <custom_utils.h>
 #include <print_utils.h>
+#include <sort_utils.h>
+#include <cpu_utils.h>
+#include <limits.h>
+#include <math.h>
+
+#ifdef UTILS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/* [ Macros ] */
+
+#define SET_GALLOP_RATIO (32)   // size ratio past which the smaller array gallops through the larger
+#define RANGE_COUNTING_RATIO (4)    // counting sort is used while max - min < len * ratio
+#define RANGE_BUCKET_MAX (64)       // largest bucket insertion sort may handle before radix takes over
 
 /*
  * partition()
@@ -54,20 +68,20 @@ int partition(int arr[], int low, int high)
 }
 
 /*
- * merge()
+ * merge_runs()
  * ----------------------
  * Description:
- *      Merges two subarrays of arr[] into a single sorted array.
- *      The first subarray is arr[l..m] and the second subarray is arr[m+1..r].
+ *      Merges arr[l..m] and arr[m+1..r] using buf, which holds at
+ *      least r - l + 1 elements.
  */
-void merge(int arr[], int l, int m, int r) 
+static void merge_runs(int arr[], int l, int m, int r, int *buf)
 {
     int i, j, k;
     int n1 = m - l + 1;
     int n2 = r - m;
 
-    int *L = (int*)malloc(n1 * sizeof(int));
-    int *R = (int*)malloc(n2 * sizeof(int));
+    int *L = buf;
+    int *R = buf + n1;
 
     for (i = 0; i < n1; i++)
         L[i] = arr[l + i];
@@ -106,9 +120,41 @@ void merge(int arr[], int l, int m, int r)
         j++;
         k++;
     }
+}
 
-    free(L);
-    free(R);
+/*
+ * merge()
+ * ----------------------
+ * Description:
+ *      Merges two subarrays of arr[] into a single sorted array.
+ *      The first subarray is arr[l..m] and the second subarray is arr[m+1..r].
+ */
+void merge(int arr[], int l, int m, int r) 
+{
+    merge_ctx(context_default(), arr, l, m, r);
+}
+
+/*
+ * merge_ctx()
+ * ----------------------
+ * Description:
+ *      merge() allocating its buffer through the context.
+ */
+int merge_ctx(Utils_Context *ctx, int arr[], int l, int m, int r)
+{
+    if (r < l)
+        return 0;
+
+    int *buf = context_alloc(ctx, (size_t)(r - l + 1) * sizeof(int));
+    if (buf == NULL)
+    {
+        print_log_ctx(ctx, "[ERROR]", RED, "Memory allocation failed for merge buffer\n");
+        return -1;
+    }
+
+    merge_runs(arr, l, m, r, buf);
+    context_release(ctx, buf);
+    return 0;
 }
 
 /*
@@ -194,6 +240,24 @@ void quick_sort(int arr[], int low, int high)
     }
 }
 
+/*
+ * merge_sort_runs()
+ * ----------------------
+ * Description:
+ *      Recursive merge sort of arr[l..r] sharing one buffer.
+ */
+static void merge_sort_runs(int arr[], int l, int r, int *buf)
+{
+    if (l < r) 
+    {
+        int m = l + (r - l) / 2;
+
+        merge_sort_runs(arr, l, m, buf);
+        merge_sort_runs(arr, m + 1, r, buf);
+        merge_runs(arr, l, m, r, buf);
+    }
+}
+
 /*
  * merge_sort()
  * ----------------------
@@ -204,14 +268,723 @@ void quick_sort(int arr[], int low, int high)
  */
 void merge_sort(int arr[], int l, int r) 
 {
-    if (l < r) 
+    merge_sort_ctx(context_default(), arr, l, r);
+}
+
+/*
+ * merge_sort_ctx()
+ * ----------------------
+ * Description:
+ *      merge_sort() allocating one buffer for the whole sort
+ *      through the context.
+ */
+int merge_sort_ctx(Utils_Context *ctx, int arr[], int l, int r)
+{
+    if (l >= r)
+        return 0;
+
+    int *buf = context_alloc(ctx, (size_t)(r - l + 1) * sizeof(int));
+    if (buf == NULL)
     {
-        int m = l + (r - l) / 2;
+        print_log_ctx(ctx, "[ERROR]", RED, "Memory allocation failed for merge buffer\n");
+        return -1;
+    }
+
+    merge_sort_runs(arr, l, r, buf);
+    context_release(ctx, buf);
+    return 0;
+}
+
+/* [ Set Operations ] */
+
+/*
+ * SET_DEFINE()
+ * ----------------------
+ * Description:
+ *      Instantiates the deduplication, merge and set kernels for one
+ *      element type. The intersection and union kernels expect a to be
+ *      the shorter array.
+ */
+#define SET_DEFINE(suffix, T)                                                   \
+static int unique_##suffix(T *a, int n, int *counts)                            \
+{                                                                               \
+    int w = 0;                                                                  \
+                                                                                \
+    for (int i = 0; i < n; ++i)                                                 \
+    {                                                                           \
+        if (w > 0 && a[i] == a[w - 1])                                          \
+        {                                                                       \
+            if (counts)                                                         \
+                counts[w - 1]++;                                                \
+            continue;                                                           \
+        }                                                                       \
+                                                                                \
+        a[w] = a[i];                                                            \
+        if (counts)                                                             \
+            counts[w] = 1;                                                      \
+        w++;                                                                    \
+    }                                                                           \
+                                                                                \
+    return w;                                                                   \
+}                                                                               \
+                                                                                \
+/* Exponential search for the first element of a[lo..n) not less than key. */   \
+static int gallop_##suffix(const T *a, int lo, int n, T key)                    \
+{                                                                               \
+    int hi = lo, step = 1;                                                      \
+                                                                                \
+    while (hi < n && a[hi] < key)                                               \
+    {                                                                           \
+        lo = hi + 1;                                                            \
+        hi += step;                                                             \
+        step *= 2;                                                              \
+    }                                                                           \
+                                                                                \
+    if (hi > n)                                                                 \
+        hi = n;                                                                 \
+                                                                                \
+    while (lo < hi)                                                             \
+    {                                                                           \
+        int mid = lo + (hi - lo) / 2;                                           \
+                                                                                \
+        if (a[mid] < key)                                                       \
+            lo = mid + 1;                                                       \
+        else                                                                    \
+            hi = mid;                                                           \
+    }                                                                           \
+                                                                                \
+    return lo;                                                                  \
+}                                                                               \
+                                                                                \
+static int merge_##suffix(T *dst, const T *a, int na, const T *b, int nb)       \
+{                                                                               \
+    int i = 0, j = 0, k = 0;                                                    \
+                                                                                \
+    while (i < na && j < nb)                                                    \
+    {                                                                           \
+        bool take_b = b[j] < a[i];                                              \
+                                                                                \
+        dst[k++] = take_b ? b[j] : a[i];                                        \
+        j += take_b;                                                            \
+        i += !take_b;                                                           \
+    }                                                                           \
+                                                                                \
+    memcpy(dst + k, a + i, (size_t)(na - i) * sizeof(T));                       \
+    memcpy(dst + k + (na - i), b + j, (size_t)(nb - j) * sizeof(T));            \
+                                                                                \
+    return na + nb;                                                             \
+}                                                                               \
+                                                                                \
+static int intersect_##suffix(T *dst, const T *a, int na, const T *b, int nb)   \
+{                                                                               \
+    int i = 0, j = 0, k = 0;                                                    \
+                                                                                \
+    if ((long long)na * SET_GALLOP_RATIO < nb)                                  \
+    {                                                                           \
+        for (i = 0; i < na && j < nb; ++i)                                      \
+        {                                                                       \
+            j = gallop_##suffix(b, j, nb, a[i]);                                \
+                                                                                \
+            if (j < nb && b[j] == a[i])                                         \
+                dst[k++] = b[j++];                                              \
+        }                                                                       \
+                                                                                \
+        return k;                                                               \
+    }                                                                           \
+                                                                                \
+    while (i < na && j < nb)                                                    \
+    {                                                                           \
+        if (a[i] < b[j])                                                        \
+            i++;                                                                \
+        else if (b[j] < a[i])                                                   \
+            j++;                                                                \
+        else                                                                    \
+        {                                                                       \
+            dst[k++] = a[i];                                                    \
+            i++;                                                                \
+            j++;                                                                \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    return k;                                                                   \
+}                                                                               \
+                                                                                \
+static int union_##suffix(T *dst, const T *a, int na, const T *b, int nb)       \
+{                                                                               \
+    int i = 0, j = 0, k = 0;                                                    \
+                                                                                \
+    if ((long long)na * SET_GALLOP_RATIO < nb)                                  \
+    {                                                                           \
+        /* Copy the runs of b between the elements of a in bulk. */             \
+        for (i = 0; i < na; ++i)                                                \
+        {                                                                       \
+            int next = gallop_##suffix(b, j, nb, a[i]);                         \
+                                                                                \
+            memcpy(dst + k, b + j, (size_t)(next - j) * sizeof(T));             \
+            k += next - j;                                                      \
+            j = next;                                                           \
+                                                                                \
+            dst[k++] = a[i];                                                    \
+            if (j < nb && b[j] == a[i])                                         \
+                j++;                                                            \
+        }                                                                       \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        while (i < na && j < nb)                                                \
+        {                                                                       \
+            if (a[i] < b[j])                                                    \
+                dst[k++] = a[i++];                                              \
+            else if (b[j] < a[i])                                               \
+                dst[k++] = b[j++];                                              \
+            else                                                                \
+            {                                                                   \
+                dst[k++] = a[i++];                                              \
+                j++;                                                            \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        memcpy(dst + k, a + i, (size_t)(na - i) * sizeof(T));                   \
+        k += na - i;                                                            \
+    }                                                                           \
+                                                                                \
+    memcpy(dst + k, b + j, (size_t)(nb - j) * sizeof(T));                       \
+    return k + (nb - j);                                                        \
+}                                                                               \
+                                                                                \
+static int difference_##suffix(T *dst, const T *a, int na, const T *b, int nb)  \
+{                                                                               \
+    int i = 0, j = 0, k = 0;                                                    \
+                                                                                \
+    if ((long long)na * SET_GALLOP_RATIO < nb)                                  \
+    {                                                                           \
+        for (i = 0; i < na; ++i)                                                \
+        {                                                                       \
+            j = gallop_##suffix(b, j, nb, a[i]);                                \
+                                                                                \
+            if (j < nb && b[j] == a[i])                                         \
+                j++;                                                            \
+            else                                                                \
+                dst[k++] = a[i];                                                \
+        }                                                                       \
+                                                                                \
+        return k;                                                               \
+    }                                                                           \
+                                                                                \
+    if ((long long)nb * SET_GALLOP_RATIO < na)                                  \
+    {                                                                           \
+        /* Copy the runs of a between the elements of b in bulk. */             \
+        for (j = 0; j < nb && i < na; ++j)                                      \
+        {                                                                       \
+            int next = gallop_##suffix(a, i, na, b[j]);                         \
+                                                                                \
+            memcpy(dst + k, a + i, (size_t)(next - i) * sizeof(T));             \
+            k += next - i;                                                      \
+            i = next;                                                           \
+                                                                                \
+            if (i < na && a[i] == b[j])                                         \
+                i++;                                                            \
+        }                                                                       \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        while (i < na && j < nb)                                                \
+        {                                                                       \
+            if (a[i] < b[j])                                                    \
+                dst[k++] = a[i++];                                              \
+            else if (b[j] < a[i])                                               \
+                j++;                                                            \
+            else                                                                \
+            {                                                                   \
+                i++;                                                            \
+                j++;                                                            \
+            }                                                                   \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    memcpy(dst + k, a + i, (size_t)(na - i) * sizeof(T));                       \
+    return k + (na - i);                                                        \
+}
+
+SET_DEFINE(int, int)
+SET_DEFINE(long, long)
+SET_DEFINE(long_long, long long)
+SET_DEFINE(float, float)
+SET_DEFINE(double, double)
+
+#ifdef UTILS_X86_SIMD
+/*
+ * intersect_int_avx2()
+ * ----------------------
+ * Description:
+ *      Intersection of int arrays of similar size. Each element of a is
+ *      broadcast and compared against eight elements of b at once; since
+ *      b is sorted, the popcount of the less-than mask is how far to skip.
+ */
+__attribute__((target("avx2,popcnt")))
+static int intersect_int_avx2(int *dst, const int *a, int na, const int *b, int nb)
+{
+    int j = 0, k = 0;
+
+    for (int i = 0; i < na && j < nb; ++i)
+    {
+        __m256i key = _mm256_set1_epi32(a[i]);
+
+        while (j + 8 <= nb)
+        {
+            __m256i blk = _mm256_loadu_si256((const __m256i *)(b + j));
+            int lt = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(key, blk)));
+
+            j += __builtin_popcount(lt);
+
+            if (lt != 0xFF)
+                break;
+        }
+
+        while (j < nb && b[j] < a[i])
+            j++;
+
+        if (j < nb && b[j] == a[i])
+            dst[k++] = b[j++];
+    }
+
+    return k;
+}
+#endif
+
+/*
+ * set_valid()
+ * ----------------------
+ * Description:
+ *      Checks the arguments shared by the merge and set operations.
+ */
+static inline bool set_valid(const void *dst, const void *a, int a_len, const void *b, int b_len, Fetch_Type type)
+{
+    if (dst == NULL || a_len < 0 || b_len < 0 || (unsigned)type > TYPE_DOUBLE)
+        return false;
+
+    return (a != NULL || a_len == 0) && (b != NULL || b_len == 0);
+}
+
+/*
+ * SET_DISPATCH()
+ * ----------------------
+ * Description:
+ *      Switches once on the type and returns the typed kernel's result.
+ */
+#define SET_DISPATCH(kernel, type, dst, a, a_len, b, b_len)                     \
+    switch (type)                                                               \
+    {                                                                           \
+        case TYPE_INT:          return kernel##_int(dst, a, a_len, b, b_len);   \
+        case TYPE_LONG:         return kernel##_long(dst, a, a_len, b, b_len);  \
+        case TYPE_LONG_LONG:    return kernel##_long_long(dst, a, a_len, b, b_len); \
+        case TYPE_FLOAT:        return kernel##_float(dst, a, a_len, b, b_len); \
+        case TYPE_DOUBLE:       return kernel##_double(dst, a, a_len, b, b_len); \
+        default:                return -1;                                      \
+    }
+
+/*
+ * unique()
+ * ----------------------
+ * Description:
+ *      Removes consecutive duplicates from a sorted array in place.
+ */
+int unique(void *arr, int len, Fetch_Type type, int *counts)
+{
+    if ((arr == NULL && len > 0) || len < 0)
+        return -1;
+
+    switch (type)
+    {
+        case TYPE_INT:          return unique_int(arr, len, counts);
+        case TYPE_LONG:         return unique_long(arr, len, counts);
+        case TYPE_LONG_LONG:    return unique_long_long(arr, len, counts);
+        case TYPE_FLOAT:        return unique_float(arr, len, counts);
+        case TYPE_DOUBLE:       return unique_double(arr, len, counts);
+        default:                return -1;
+    }
+}
+
+/*
+ * merge_arrays()
+ * ----------------------
+ * Description:
+ *      Merges two sorted arrays into a caller-provided buffer.
+ */
+int merge_arrays(void *dst, const void *a, int a_len, const void *b, int b_len, Fetch_Type type)
+{
+    if (!set_valid(dst, a, a_len, b, b_len, type))
+        return -1;
+
+    SET_DISPATCH(merge, type, dst, a, a_len, b, b_len);
+}
+
+/*
+ * set_intersection()
+ * ----------------------
+ * Description:
+ *      Writes the elements present in both sorted arrays.
+ */
+int set_intersection(void *dst, const void *a, int a_len, const void *b, int b_len, Fetch_Type type)
+{
+    if (!set_valid(dst, a, a_len, b, b_len, type))
+        return -1;
 
-        merge_sort(arr, l, m);
-        merge_sort(arr, m + 1, r);
-        merge(arr, l, m, r);
+    /* The kernels walk the shorter array. */
+    if (a_len > b_len)
+    {
+        const void *tmp = a;
+        a = b;
+        b = tmp;
+
+        int tmp_len = a_len;
+        a_len = b_len;
+        b_len = tmp_len;
     }
+
+#ifdef UTILS_X86_SIMD
+    if (type == TYPE_INT && (long long)a_len * SET_GALLOP_RATIO >= b_len && cpu_tier() >= CPU_TIER_AVX2)
+        return intersect_int_avx2(dst, a, a_len, b, b_len);
+#endif
+
+    SET_DISPATCH(intersect, type, dst, a, a_len, b, b_len);
+}
+
+/*
+ * set_union()
+ * ----------------------
+ * Description:
+ *      Writes the elements present in either sorted array.
+ */
+int set_union(void *dst, const void *a, int a_len, const void *b, int b_len, Fetch_Type type)
+{
+    if (!set_valid(dst, a, a_len, b, b_len, type))
+        return -1;
+
+    /* The kernels walk the shorter array. */
+    if (a_len > b_len)
+    {
+        const void *tmp = a;
+        a = b;
+        b = tmp;
+
+        int tmp_len = a_len;
+        a_len = b_len;
+        b_len = tmp_len;
+    }
+
+    SET_DISPATCH(union, type, dst, a, a_len, b, b_len);
+}
+
+/*
+ * set_difference()
+ * ----------------------
+ * Description:
+ *      Writes the elements of a that are not in b.
+ */
+int set_difference(void *dst, const void *a, int a_len, const void *b, int b_len, Fetch_Type type)
+{
+    if (!set_valid(dst, a, a_len, b, b_len, type))
+        return -1;
+
+    SET_DISPATCH(difference, type, dst, a, a_len, b, b_len);
+}
+
+/* [ Range Sorting ] */
+
+/*
+ * RANGE_RADIX()
+ * ----------------------
+ * Description:
+ *      Stable LSD radix sort on 8-bit digits of KEY(x). Only the passes
+ *      needed to cover the key range are run, and a pass whose digit is
+ *      the same for every element is skipped.
+ */
+#define RANGE_RADIX(name, T, KEY)                                               \
+static int name(Utils_Context *ctx, T *a, int n, int passes, unsigned long long lo) \
+{                                                                               \
+    T *tmp = context_alloc(ctx, (size_t)n * sizeof(T));                         \
+    T *src = a, *dst = tmp;                                                     \
+                                                                                \
+    if (tmp == NULL)                                                            \
+        return -1;                                                              \
+                                                                                \
+    (void)lo;                                                                   \
+                                                                                \
+    for (int p = 0; p < passes; ++p)                                            \
+    {                                                                           \
+        int counts[256] = { 0 };                                                \
+        int shift = 8 * p;                                                      \
+                                                                                \
+        for (int i = 0; i < n; ++i)                                             \
+            counts[(KEY(src[i]) >> shift) & 0xFF]++;                            \
+                                                                                \
+        if (counts[(KEY(src[0]) >> shift) & 0xFF] == n)                         \
+            continue;                                                           \
+                                                                                \
+        for (int d = 0, sum = 0; d < 256; ++d)                                  \
+        {                                                                       \
+            int cnt = counts[d];                                                \
+            counts[d] = sum;                                                    \
+            sum += cnt;                                                         \
+        }                                                                       \
+                                                                                \
+        for (int i = 0; i < n; ++i)                                             \
+            dst[counts[(KEY(src[i]) >> shift) & 0xFF]++] = src[i];              \
+                                                                                \
+        T *swap = src;                                                          \
+        src = dst;                                                              \
+        dst = swap;                                                             \
+    }                                                                           \
+                                                                                \
+    if (src != a)                                                               \
+        memcpy(a, src, (size_t)n * sizeof(T));                                  \
+                                                                                \
+    context_release(ctx, tmp);                                                  \
+    return 0;                                                                   \
+}
+
+/* Integers are keyed by their offset from the lower bound. */
+#define RANGE_INT_KEY(x) ((unsigned long long)(x) - lo)
+
+/*
+ * RANGE_SORT_INT()
+ * ----------------------
+ * Description:
+ *      Integer range sort. A narrow range is counted and rewritten in
+ *      O(n + range); a wide one is radix sorted on the offsets from lo,
+ *      with only as many passes as the range needs.
+ */
+#define RANGE_SORT_INT(suffix, T)                                               \
+RANGE_RADIX(range_radix_##suffix, T, RANGE_INT_KEY)                             \
+                                                                                \
+static int range_sort_##suffix(Utils_Context *ctx, T *a, int n, long long lo, long long hi) \
+{                                                                               \
+    for (int i = 0; i < n; ++i)                                                 \
+    {                                                                           \
+        if (a[i] < lo || a[i] > hi)                                             \
+            return -1;                                                          \
+    }                                                                           \
+                                                                                \
+    unsigned long long span = (unsigned long long)hi - (unsigned long long)lo;  \
+                                                                                \
+    if (span < (unsigned long long)n * RANGE_COUNTING_RATIO)                    \
+    {                                                                           \
+        int *counts = context_alloc(ctx, (span + 1) * sizeof(int));             \
+        if (counts == NULL)                                                     \
+            return -1;                                                          \
+                                                                                \
+        memset(counts, 0, (span + 1) * sizeof(int));                            \
+                                                                                \
+        for (int i = 0; i < n; ++i)                                             \
+            counts[(unsigned long long)a[i] - (unsigned long long)lo]++;        \
+                                                                                \
+        for (unsigned long long v = 0, k = 0; v <= span; ++v)                   \
+        {                                                                       \
+            for (int c = counts[v]; c > 0; --c)                                 \
+                a[k++] = (T)(lo + (long long)v);                                \
+        }                                                                       \
+                                                                                \
+        context_release(ctx, counts);                                           \
+        return 0;                                                               \
+    }                                                                           \
+                                                                                \
+    int passes = 0;                                                             \
+    while (passes < 8 && (span >> (8 * passes)) != 0)                           \
+        passes++;                                                               \
+                                                                                \
+    return range_radix_##suffix(ctx, a, n, passes, (unsigned long long)lo);     \
+}
+
+/*
+ * range_bucket()
+ * ----------------------
+ * Description:
+ *      Turns a scaled offset into a bucket index clamped to [0, n - 1].
+ */
+static inline int range_bucket(double pos, int n)
+{
+    return pos > 0 ? (pos < n ? (int)pos : n - 1) : 0;
+}
+
+/*
+ * RANGE_SORT_FLOAT()
+ * ----------------------
+ * Description:
+ *      Floating-point range sort. Values are scattered into len equal-width
+ *      buckets spanning [min, max] and each bucket is insertion sorted,
+ *      which is linear for evenly spread data. When the data is skewed
+ *      enough to overfill a bucket, the array is radix sorted instead on
+ *      an order-preserving view of its bits.
+ */
+#define RANGE_SORT_FLOAT(suffix, T, U)                                          \
+static inline unsigned long long range_key_##suffix(T x)                        \
+{                                                                               \
+    const U sign = (U)1 << (sizeof(U) * 8 - 1);                                 \
+    U u;                                                                        \
+                                                                                \
+    memcpy(&u, &x, sizeof(u));                                                  \
+    return (u & sign) ? (U)~u : (U)(u | sign);                                  \
+}                                                                               \
+                                                                                \
+RANGE_RADIX(range_radix_##suffix, T, range_key_##suffix)                        \
+                                                                                \
+static int range_sort_##suffix(Utils_Context *ctx, T *a, int n, double min, double max) \
+{                                                                               \
+    for (int i = 0; i < n; ++i)                                                 \
+    {                                                                           \
+        if (!(a[i] >= min && a[i] <= max))                                      \
+            return -1;                                                          \
+    }                                                                           \
+                                                                                \
+    if (!(max > min))                                                           \
+        return 0;                                                               \
+                                                                                \
+    /* Spans that overflow, or make scale overflow, have no buckets. */        \
+    double scale = n / (max - min);                                             \
+                                                                                \
+    if (!isfinite(max - min) || !isfinite(scale))                               \
+        return range_radix_##suffix(ctx, a, n, (int)sizeof(T), 0);              \
+                                                                                \
+    int *offs = context_alloc(ctx, ((size_t)n + 1) * sizeof(int));              \
+    T *tmp = context_alloc(ctx, (size_t)n * sizeof(T));                         \
+    int largest = 0;                                                            \
+                                                                                \
+    if (offs == NULL || tmp == NULL)                                            \
+    {                                                                           \
+        context_release(ctx, offs);                                             \
+        context_release(ctx, tmp);                                              \
+        return -1;                                                              \
+    }                                                                           \
+                                                                                \
+    memset(offs, 0, ((size_t)n + 1) * sizeof(int));                             \
+                                                                                \
+    for (int i = 0; i < n; ++i)                                                 \
+        offs[range_bucket((a[i] - min) * scale, n) + 1]++;                      \
+                                                                                \
+    for (int b = 1; b <= n; ++b)                                                \
+    {                                                                           \
+        largest = offs[b] > largest ? offs[b] : largest;                        \
+        offs[b] += offs[b - 1];                                                 \
+    }                                                                           \
+                                                                                \
+    if (largest > RANGE_BUCKET_MAX)                                             \
+    {                                                                           \
+        context_release(ctx, offs);                                             \
+        context_release(ctx, tmp);                                              \
+        return range_radix_##suffix(ctx, a, n, (int)sizeof(T), 0);              \
+    }                                                                           \
+                                                                                \
+    /* offs[b] is the start of bucket b, and its end once scattered. */         \
+    for (int i = 0; i < n; ++i)                                                 \
+        tmp[offs[range_bucket((a[i] - min) * scale, n)]++] = a[i];              \
+                                                                                \
+    for (int b = 0, start = 0; b < n; start = offs[b++])                        \
+    {                                                                           \
+        for (int i = start + 1; i < offs[b]; ++i)                               \
+        {                                                                       \
+            T key = tmp[i];                                                     \
+            int j = i - 1;                                                      \
+                                                                                \
+            while (j >= start && tmp[j] > key)                                  \
+            {                                                                   \
+                tmp[j + 1] = tmp[j];                                            \
+                --j;                                                            \
+            }                                                                   \
+                                                                                \
+            tmp[j + 1] = key;                                                   \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    memcpy(a, tmp, (size_t)n * sizeof(T));                                      \
+    context_release(ctx, offs);                                                 \
+    context_release(ctx, tmp);                                                  \
+    return 0;                                                                   \
+}
+
+RANGE_SORT_INT(int, int)
+RANGE_SORT_INT(long, long)
+RANGE_SORT_INT(long_long, long long)
+RANGE_SORT_FLOAT(float, float, unsigned int)
+RANGE_SORT_FLOAT(double, double, unsigned long long)
+
+/*
+ * range_bounds()
+ * ----------------------
+ * Description:
+ *      Rounds the double bounds inward to integers and clamps both to
+ *      the limits of the element type before any cast, returning false
+ *      if no value of the type lies in [min, max].
+ */
+static bool range_bounds(double min, double max, long long limit_lo, long long limit_hi, long long *lo, long long *hi)
+{
+    if (max < (double)limit_lo || min > (double)limit_hi)
+        return false;
+
+    *lo = min <= (double)limit_lo ? limit_lo : min >= (double)limit_hi ? limit_hi : (long long)ceil(min);
+    *hi = max >= (double)limit_hi ? limit_hi : max <= (double)limit_lo ? limit_lo : (long long)floor(max);
+
+    return *lo <= *hi;
+}
+
+/*
+ * range_sort()
+ * ----------------------
+ * Description:
+ *      Sorts an array whose values lie in [min, max], picking counting,
+ *      bucket or radix sort from the size of the range.
+ */
+int range_sort(void *arr, int len, Fetch_Type type, double min, double max)
+{
+    return range_sort_ctx(context_default(), arr, len, type, min, max);
+}
+
+/*
+ * range_sort_ctx()
+ * ----------------------
+ * Description:
+ *      range_sort() allocating and logging through the context.
+ */
+int range_sort_ctx(Utils_Context *ctx, void *arr, int len, Fetch_Type type, double min, double max)
+{
+    int status;
+    long long lo, hi;
+
+    if ((arr == NULL && len > 0) || len < 0 || !(min <= max))
+    {
+        print_log_ctx(ctx, "[ERROR]", RED, "Invalid range sort arguments\n");
+        return -1;
+    }
+
+    if (len < 2)
+        return 0;
+
+    switch (type)
+    {
+        case TYPE_INT:
+            status = range_bounds(min, max, INT_MIN, INT_MAX, &lo, &hi) ? range_sort_int(ctx, arr, len, lo, hi) : -1;
+            break;
+        case TYPE_LONG:
+            status = range_bounds(min, max, LONG_MIN, LONG_MAX, &lo, &hi) ? range_sort_long(ctx, arr, len, lo, hi) : -1;
+            break;
+        case TYPE_LONG_LONG:
+            status = range_bounds(min, max, LLONG_MIN, LLONG_MAX, &lo, &hi) ? range_sort_long_long(ctx, arr, len, lo, hi) : -1;
+            break;
+        case TYPE_FLOAT:
+            status = range_sort_float(ctx, arr, len, min, max);
+            break;
+        case TYPE_DOUBLE:
+            status = range_sort_double(ctx, arr, len, min, max);
+            break;
+        default:
+            print_log_ctx(ctx, "[ERROR]", RED, "Unsupported type for range sort\n");
+            return -1;
+    }
+
+    if (status != 0)
+        print_log_ctx(ctx, "[ERROR]", RED, "Range sort failed: value outside [ %.1lf ] => [ %.1lf ] or allocation failure\n", min, max);
+
+    return status;
 }
 
 /* sort_utils.c */
\ No newline at end of file
@@ -0,0 +1,692 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : sorted_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at keeping arrays sorted under inserts and removals.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <sorted_utils.h>
+#include <search_utils.h>
+#include <sort_utils.h>
+#include <sort_template.h>
+#include <limits.h>
+#include <math.h>
+
+/* [ Structs ] */
+
+/* A value of any Fetch_Type. */
+typedef union
+{
+    int i;
+    long l;
+    long long ll;
+    float f;
+    double d;
+} Sorted_Value;
+
+/* The typed kernels of one Fetch_Type. */
+typedef struct
+{
+    void (*sort)(void *arr, int len);
+    void (*merge_back)(void *a, int a_len, const void *b, int b_len);
+    int (*scan)(const void *tail, int len, const void *key, bool inclusive);
+    int (*find)(const void *tail, int len, const void *key);
+    bool (*next)(const Sorted_Array *sorted, const void *key, bool strict, void *out);
+    void (*select)(const void *a, int a_len, const void *b, int b_len, int k, void *out);
+} Sorted_Kernels;
+
+/* [ Kernels ] */
+
+/*
+ * SORTED_DEFINE()
+ * ----------------------
+ * Description:
+ *      Generates the kernels of one type:
+ *
+ *      - sort       : introsort from sort_template.h.
+ *      - merge_back : merges b into a, which has room for both, from
+ *                     the back so nothing needs a second buffer.
+ *      - scan       : counts the values of an unsorted tail below
+ *                     (or up to) a key.
+ *      - find       : index of a value in an unsorted tail, or -1.
+ *      - next       : smallest value of the base, run and tail not
+ *                     less than (or greater than) a key.
+ *      - select     : k-th smallest value of two sorted arrays, by a
+ *                     binary search on how many come from the first.
+ */
+#define SORTED_LESS(a, b) ((a) < (b))
+
+#define SORTED_DEFINE(suffix, T, TYPE)                                          \
+SORT_DEFINE(sorted_##suffix, T, SORTED_LESS)                                    \
+                                                                                \
+static void sorted_sort_##suffix(void *arr, int len)                            \
+{                                                                               \
+    sorted_##suffix##_sort(arr, len);                                           \
+}                                                                               \
+                                                                                \
+static void sorted_merge_back_##suffix(void *a_arr, int a_len, const void *b_arr, int b_len) \
+{                                                                               \
+    T *a = a_arr;                                                               \
+    const T *b = b_arr;                                                         \
+    int i = a_len - 1, j = b_len - 1, k = a_len + b_len - 1;                    \
+                                                                                \
+    while (j >= 0)                                                              \
+        a[k--] = i >= 0 && b[j] < a[i] ? a[i--] : b[j--];                       \
+}                                                                               \
+                                                                                \
+static int sorted_scan_##suffix(const void *tail_arr, int len, const void *key_ptr, bool inclusive) \
+{                                                                               \
+    const T *tail = tail_arr;                                                   \
+    T key = *(const T *)key_ptr;                                                \
+    int n = 0;                                                                  \
+                                                                                \
+    if (inclusive)                                                              \
+    {                                                                           \
+        for (int i = 0; i < len; ++i)                                           \
+            n += tail[i] <= key;                                                \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        for (int i = 0; i < len; ++i)                                           \
+            n += tail[i] < key;                                                 \
+    }                                                                           \
+                                                                                \
+    return n;                                                                   \
+}                                                                               \
+                                                                                \
+static int sorted_find_##suffix(const void *tail_arr, int len, const void *key_ptr) \
+{                                                                               \
+    const T *tail = tail_arr;                                                   \
+    T key = *(const T *)key_ptr;                                                \
+                                                                                \
+    for (int i = 0; i < len; ++i)                                               \
+    {                                                                           \
+        if (tail[i] == key)                                                     \
+            return i;                                                           \
+    }                                                                           \
+                                                                                \
+    return -1;                                                                  \
+}                                                                               \
+                                                                                \
+static bool sorted_next_##suffix(const Sorted_Array *sorted, const void *key_ptr, bool strict, void *out) \
+{                                                                               \
+    int (*bound)(const void *, int, Fetch_Type, const void *) =                 \
+        strict ? search_upper_bound_branchless : search_lower_bound_branchless; \
+    const T *base = sorted->base, *run = sorted->run, *tail = sorted->tail;     \
+    T key = *(const T *)key_ptr;                                                \
+    T best = 0;                                                                 \
+    bool found = false;                                                         \
+                                                                                \
+    int i = bound(base, sorted->len, TYPE, key_ptr);                            \
+    if (i < sorted->len)                                                        \
+    {                                                                           \
+        best = base[i];                                                         \
+        found = true;                                                           \
+    }                                                                           \
+                                                                                \
+    i = bound(run, sorted->run_len, TYPE, key_ptr);                             \
+    if (i < sorted->run_len && (!found || run[i] < best))                       \
+    {                                                                           \
+        best = run[i];                                                          \
+        found = true;                                                           \
+    }                                                                           \
+                                                                                \
+    for (int j = 0; j < sorted->tail_len; ++j)                                  \
+    {                                                                           \
+        bool after = strict ? key < tail[j] : !(tail[j] < key);                 \
+                                                                                \
+        if (after && (!found || tail[j] < best))                                \
+        {                                                                       \
+            best = tail[j];                                                     \
+            found = true;                                                       \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    if (found)                                                                  \
+        *(T *)out = best;                                                       \
+                                                                                \
+    return found;                                                               \
+}                                                                               \
+                                                                                \
+static void sorted_select_##suffix(const void *a_arr, int a_len, const void *b_arr, int b_len, int k, void *out) \
+{                                                                               \
+    const T *a = a_arr, *b = b_arr;                                             \
+    int lo = k + 1 - b_len > 0 ? k + 1 - b_len : 0;                             \
+    int hi = k + 1 < a_len ? k + 1 : a_len;                                     \
+                                                                                \
+    /* Smallest i such that the first k + 1 values hold i from a. */            \
+    while (lo < hi)                                                             \
+    {                                                                           \
+        int i = lo + (hi - lo) / 2, j = k + 1 - i;                              \
+                                                                                \
+        if (j > 0 && i < a_len && !(b[j - 1] < a[i]))                           \
+            lo = i + 1;                                                         \
+        else                                                                    \
+            hi = i;                                                             \
+    }                                                                           \
+                                                                                \
+    int i = lo, j = k + 1 - lo;                                                 \
+    T value = i > 0 ? a[i - 1] : b[j - 1];                                      \
+                                                                                \
+    if (i > 0 && j > 0 && value < b[j - 1])                                     \
+        value = b[j - 1];                                                       \
+                                                                                \
+    *(T *)out = value;                                                          \
+}
+
+SORTED_DEFINE(int, int, TYPE_INT)
+SORTED_DEFINE(long, long, TYPE_LONG)
+SORTED_DEFINE(long_long, long long, TYPE_LONG_LONG)
+SORTED_DEFINE(float, float, TYPE_FLOAT)
+SORTED_DEFINE(double, double, TYPE_DOUBLE)
+
+#define SORTED_KERNELS(suffix)                                                  \
+    {                                                                           \
+        .sort = sorted_sort_##suffix,                                           \
+        .merge_back = sorted_merge_back_##suffix,                               \
+        .scan = sorted_scan_##suffix,                                           \
+        .find = sorted_find_##suffix,                                           \
+        .next = sorted_next_##suffix,                                           \
+        .select = sorted_select_##suffix,                                       \
+    }
+
+static const Sorted_Kernels sorted_kernels[] = {
+    [TYPE_INT] = SORTED_KERNELS(int),
+    [TYPE_LONG] = SORTED_KERNELS(long),
+    [TYPE_LONG_LONG] = SORTED_KERNELS(long_long),
+    [TYPE_FLOAT] = SORTED_KERNELS(float),
+    [TYPE_DOUBLE] = SORTED_KERNELS(double),
+};
+
+/* [ Helpers ] */
+
+/*
+ * sorted_valid()
+ * ----------------------
+ * Description:
+ *      Checks that a sorted array was initialized.
+ */
+static inline bool sorted_valid(const Sorted_Array *sorted)
+{
+    return sorted != NULL && sorted->tail != NULL && (unsigned)sorted->type <= TYPE_DOUBLE;
+}
+
+/*
+ * sorted_rank_at()
+ * ----------------------
+ * Description:
+ *      Counts the values below (or up to) a key over every
+ *      level, minus the pending removals.
+ */
+static int sorted_rank_at(const Sorted_Array *sorted, const void *key, bool inclusive)
+{
+    int (*bound)(const void *, int, Fetch_Type, const void *) =
+        inclusive ? search_upper_bound_branchless : search_lower_bound_branchless;
+    const Sorted_Kernels *kernels = &sorted_kernels[sorted->type];
+    Fetch_Type type = sorted->type;
+
+    return bound(sorted->base, sorted->len, type, key) + bound(sorted->run, sorted->run_len, type, key) +
+           kernels->scan(sorted->tail, sorted->tail_len, key, inclusive) -
+           bound(sorted->dels, sorted->dels_len, type, key) -
+           kernels->scan(sorted->dtail, sorted->dtail_len, key, inclusive);
+}
+
+/*
+ * sorted_reserve()
+ * ----------------------
+ * Description:
+ *      Grows the base and its merge target to hold need values.
+ */
+static int sorted_reserve(Sorted_Array *sorted, int need)
+{
+    if (need <= sorted->capacity)
+        return 0;
+
+    size_t size = type_sizes[sorted->type];
+    int capacity = sorted->capacity > INT_MAX / 2 ? INT_MAX : sorted->capacity * 2;
+
+    if (capacity < need)
+        capacity = need;
+
+    void *base = realloc(sorted->base, (size_t)capacity * size);
+    if (base != NULL)
+        sorted->base = base;
+
+    void *spare = base != NULL ? realloc(sorted->spare, (size_t)capacity * size) : NULL;
+    if (spare == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for %d sorted values\n", capacity);
+        return -1;
+    }
+
+    sorted->spare = spare;
+    sorted->capacity = capacity;
+    return 0;
+}
+
+/*
+ * sorted_step()
+ * ----------------------
+ * Description:
+ *      Merges a pending buffer into the base, or subtracts it,
+ *      through the spare buffer, then empties it. On failure
+ *      the base and the buffer are left as they were.
+ */
+static int sorted_step(Sorted_Array *sorted, const void *arr, int *arr_len, bool subtract)
+{
+    if (*arr_len == 0)
+        return 0;
+
+    int n = subtract ? set_difference(sorted->spare, sorted->base, sorted->len, arr, *arr_len, sorted->type)
+                     : merge_arrays(sorted->spare, sorted->base, sorted->len, arr, *arr_len, sorted->type);
+
+    if (n < 0)
+        return -1;
+
+    void *swap = sorted->base;
+    sorted->base = sorted->spare;
+    sorted->spare = swap;
+    sorted->len = n;
+    *arr_len = 0;
+
+    return 0;
+}
+
+/*
+ * sorted_compact()
+ * ----------------------
+ * Description:
+ *      Merges the run and the tail into the base and applies
+ *      the pending removals, then raises the run limit to
+ *      about sqrt(SORTED_TAIL * count).
+ */
+static int sorted_compact(Sorted_Array *sorted)
+{
+    const Sorted_Kernels *kernels = &sorted_kernels[sorted->type];
+    long long total = (long long)sorted->len + sorted->run_len + sorted->tail_len;
+
+    if (total == sorted->len && sorted->dels_len == 0 && sorted->dtail_len == 0)
+        return 0;
+
+    if (total > INT_MAX || sorted_reserve(sorted, (int)total) != 0)
+        return -1;
+
+    kernels->sort(sorted->tail, sorted->tail_len);
+    kernels->sort(sorted->dtail, sorted->dtail_len);
+
+    /* Each step empties its buffer only once merged, so a failure loses nothing. */
+    if (sorted_step(sorted, sorted->run, &sorted->run_len, false) != 0 ||
+        sorted_step(sorted, sorted->tail, &sorted->tail_len, false) != 0 ||
+        sorted_step(sorted, sorted->dels, &sorted->dels_len, true) != 0 ||
+        sorted_step(sorted, sorted->dtail, &sorted->dtail_len, true) != 0)
+        return -1;
+
+    int n = sorted->len;
+    sorted->count = n;
+
+    /* Merging a run costs O(run) per tail and O(n) per run; balance both. */
+    double limit = sqrt((double)n * SORTED_TAIL);
+
+    if (limit > sorted->run_limit && limit < INT_MAX - SORTED_TAIL)
+    {
+        size_t bytes = ((size_t)limit + SORTED_TAIL) * type_sizes[sorted->type];
+        void *run = realloc(sorted->run, bytes);
+        void *dels = run != NULL ? realloc(sorted->dels, bytes) : NULL;
+
+        /* A failure only keeps the old limit. */
+        if (run != NULL)
+            sorted->run = run;
+        if (dels != NULL)
+        {
+            sorted->dels = dels;
+            sorted->run_limit = (int)limit;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * sorted_absorb()
+ * ----------------------
+ * Description:
+ *      Sorts the insert (or removal) tail into its run, and
+ *      compacts once the run is over the limit.
+ */
+static int sorted_absorb(Sorted_Array *sorted, bool removals)
+{
+    const Sorted_Kernels *kernels = &sorted_kernels[sorted->type];
+    void *run = removals ? sorted->dels : sorted->run;
+    void *tail = removals ? sorted->dtail : sorted->tail;
+    int *run_len = removals ? &sorted->dels_len : &sorted->run_len;
+    int *tail_len = removals ? &sorted->dtail_len : &sorted->tail_len;
+
+    /* A compaction that failed last time must succeed before the run can take more. */
+    if (*run_len > sorted->run_limit)
+        return sorted_compact(sorted);
+
+    kernels->sort(tail, *tail_len);
+    kernels->merge_back(run, *run_len, tail, *tail_len);
+    *run_len += *tail_len;
+    *tail_len = 0;
+
+    if (*run_len > sorted->run_limit)
+        sorted_compact(sorted);
+
+    return 0;
+}
+
+/*
+ * sorted_settle()
+ * ----------------------
+ * Description:
+ *      Applies pending removals and empties the insert tail,
+ *      leaving the values in the base and the run only.
+ */
+static int sorted_settle(Sorted_Array *sorted)
+{
+    if (sorted->dels_len > 0 || sorted->dtail_len > 0)
+        return sorted_compact(sorted);
+
+    if (sorted->tail_len > 0)
+        return sorted_absorb(sorted, false);
+
+    return 0;
+}
+
+/* [ Functions ] */
+
+/*
+ * sorted_init()
+ * ----------------------
+ * Description:
+ *      Creates an empty sorted array.
+ */
+int sorted_init(Sorted_Array *sorted, Fetch_Type type)
+{
+    if (sorted == NULL || (unsigned)type > TYPE_DOUBLE)
+        return -1;
+
+    size_t size = type_sizes[type];
+
+    memset(sorted, 0, sizeof(*sorted));
+    sorted->type = type;
+    sorted->run_limit = SORTED_RUN_MIN;
+    sorted->tail = malloc(SORTED_TAIL * size);
+    sorted->dtail = malloc(SORTED_TAIL * size);
+    sorted->run = malloc((size_t)(SORTED_RUN_MIN + SORTED_TAIL) * size);
+    sorted->dels = malloc((size_t)(SORTED_RUN_MIN + SORTED_TAIL) * size);
+
+    if (sorted->tail == NULL || sorted->dtail == NULL || sorted->run == NULL || sorted->dels == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for sorted array\n");
+        sorted_free(sorted);
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * sorted_free()
+ * ----------------------
+ * Description:
+ *      Releases the memory held by a sorted array.
+ */
+void sorted_free(Sorted_Array *sorted)
+{
+    if (sorted == NULL)
+        return;
+
+    free(sorted->base);
+    free(sorted->spare);
+    free(sorted->run);
+    free(sorted->tail);
+    free(sorted->dels);
+    free(sorted->dtail);
+    memset(sorted, 0, sizeof(*sorted));
+}
+
+/*
+ * sorted_insert_batch()
+ * ----------------------
+ * Description:
+ *      Adds an array of values.
+ */
+int sorted_insert_batch(Sorted_Array *sorted, const void *values, int len)
+{
+    if (!sorted_valid(sorted) || len < 0 || (values == NULL && len > 0))
+        return -1;
+
+    if (len > INT_MAX - sorted->count - sorted->dels_len - sorted->dtail_len)
+    {
+        print_log("[ERROR]", RED, "Sorted array cannot hold more than %d values\n", INT_MAX);
+        return -1;
+    }
+
+    const Sorted_Kernels *kernels = &sorted_kernels[sorted->type];
+    size_t size = type_sizes[sorted->type];
+
+    /* Too large for the run: sort it on its own and merge it into the base. */
+    if (len > sorted->run_limit)
+    {
+        if (sorted_reserve(sorted, sorted->len + len) != 0)
+            return -1;
+
+        memcpy(sorted->spare, values, (size_t)len * size);
+        kernels->sort(sorted->spare, len);
+        kernels->merge_back(sorted->base, sorted->len, sorted->spare, len);
+        sorted->len += len;
+        sorted->count += len;
+        return 0;
+    }
+
+    const char *src = values;
+
+    while (len > 0)
+    {
+        if (sorted->tail_len == SORTED_TAIL && sorted_absorb(sorted, false) != 0)
+            return -1;
+
+        int chunk = SORTED_TAIL - sorted->tail_len < len ? SORTED_TAIL - sorted->tail_len : len;
+
+        memcpy((char *)sorted->tail + (size_t)sorted->tail_len * size, src, (size_t)chunk * size);
+        sorted->tail_len += chunk;
+        sorted->count += chunk;
+        src += (size_t)chunk * size;
+        len -= chunk;
+    }
+
+    return 0;
+}
+
+/*
+ * sorted_insert()
+ * ----------------------
+ * Description:
+ *      Adds one value.
+ */
+int sorted_insert(Sorted_Array *sorted, const void *value)
+{
+    if (value == NULL)
+        return -1;
+
+    return sorted_insert_batch(sorted, value, 1);
+}
+
+/*
+ * sorted_remove()
+ * ----------------------
+ * Description:
+ *      Removes one occurrence of a value.
+ */
+int sorted_remove(Sorted_Array *sorted, const void *value)
+{
+    if (!sorted_valid(sorted) || value == NULL)
+        return -1;
+
+    if (sorted_rank_at(sorted, value, true) == sorted_rank_at(sorted, value, false))
+        return 0;
+
+    const Sorted_Kernels *kernels = &sorted_kernels[sorted->type];
+    size_t size = type_sizes[sorted->type];
+
+    /* Still in the tail: take it out there instead of recording a removal. */
+    int i = kernels->find(sorted->tail, sorted->tail_len, value);
+    if (i >= 0)
+    {
+        sorted->tail_len--;
+        memcpy((char *)sorted->tail + (size_t)i * size, (char *)sorted->tail + (size_t)sorted->tail_len * size, size);
+        sorted->count--;
+        return 1;
+    }
+
+    if (sorted->dtail_len == SORTED_TAIL && sorted_absorb(sorted, true) != 0)
+        return -1;
+
+    memcpy((char *)sorted->dtail + (size_t)sorted->dtail_len * size, value, size);
+    sorted->dtail_len++;
+    sorted->count--;
+    return 1;
+}
+
+/*
+ * sorted_rank()
+ * ----------------------
+ * Description:
+ *      Counts the values less than a key.
+ */
+int sorted_rank(const Sorted_Array *sorted, const void *key)
+{
+    if (!sorted_valid(sorted) || key == NULL)
+        return -1;
+
+    return sorted_rank_at(sorted, key, false);
+}
+
+/*
+ * sorted_count_range()
+ * ----------------------
+ * Description:
+ *      Counts the values in [lo, hi].
+ */
+int sorted_count_range(const Sorted_Array *sorted, const void *lo, const void *hi)
+{
+    if (!sorted_valid(sorted) || lo == NULL || hi == NULL)
+        return -1;
+
+    int n = sorted_rank_at(sorted, hi, true) - sorted_rank_at(sorted, lo, false);
+    return n > 0 ? n : 0;
+}
+
+/*
+ * sorted_lower_bound()
+ * ----------------------
+ * Description:
+ *      Finds the smallest value not less than a key.
+ */
+int sorted_lower_bound(const Sorted_Array *sorted, const void *key, void *out)
+{
+    if (!sorted_valid(sorted) || key == NULL || out == NULL)
+        return -1;
+
+    const Sorted_Kernels *kernels = &sorted_kernels[sorted->type];
+    bool pending = sorted->dels_len > 0 || sorted->dtail_len > 0;
+    bool strict = false;
+    Sorted_Value value, after;
+
+    while (kernels->next(sorted, key, strict, &value))
+    {
+        if (!pending || sorted_rank_at(sorted, &value, true) > sorted_rank_at(sorted, &value, false))
+        {
+            memcpy(out, &value, type_sizes[sorted->type]);
+            return 1;
+        }
+
+        /* Every copy of the candidate was removed, look past it. */
+        after = value;
+        key = &after;
+        strict = true;
+    }
+
+    return 0;
+}
+
+/*
+ * sorted_select()
+ * ----------------------
+ * Description:
+ *      Finds the k-th smallest value.
+ */
+int sorted_select(Sorted_Array *sorted, int k, void *out)
+{
+    if (!sorted_valid(sorted) || out == NULL || k < 0 || k >= sorted->count)
+        return -1;
+
+    if (sorted_settle(sorted) != 0)
+        return -1;
+
+    sorted_kernels[sorted->type].select(sorted->base, sorted->len, sorted->run, sorted->run_len, k, out);
+    return 0;
+}
+
+/*
+ * sorted_range()
+ * ----------------------
+ * Description:
+ *      Copies the values in [lo, hi] out in order.
+ */
+int sorted_range(Sorted_Array *sorted, const void *lo, const void *hi, void *out)
+{
+    if (!sorted_valid(sorted) || lo == NULL || hi == NULL || out == NULL)
+        return -1;
+
+    if (sorted_settle(sorted) != 0)
+        return -1;
+
+    Fetch_Type type = sorted->type;
+    int a0 = search_lower_bound_branchless(sorted->base, sorted->len, type, lo);
+    int a1 = search_upper_bound_branchless(sorted->base, sorted->len, type, hi);
+    int b0 = search_lower_bound_branchless(sorted->run, sorted->run_len, type, lo);
+    int b1 = search_upper_bound_branchless(sorted->run, sorted->run_len, type, hi);
+
+    /* lo > hi leaves the upper bound before the lower one. */
+    int a_len = a1 > a0 ? a1 - a0 : 0;
+    int b_len = b1 > b0 ? b1 - b0 : 0;
+    size_t size = type_sizes[type];
+
+    if (a_len == 0 || b_len == 0)
+    {
+        const char *src = a_len > 0 ? (const char *)sorted->base + (size_t)a0 * size : (const char *)sorted->run + (size_t)b0 * size;
+
+        memcpy(out, src, (size_t)(a_len + b_len) * size);
+        return a_len + b_len;
+    }
+
+    return merge_arrays(out, (char *)sorted->base + (size_t)a0 * size, a_len, (char *)sorted->run + (size_t)b0 * size, b_len, type);
+}
+
+/*
+ * sorted_flush()
+ * ----------------------
+ * Description:
+ *      Merges every pending change into the base.
+ */
+int sorted_flush(Sorted_Array *sorted)
+{
+    if (!sorted_valid(sorted))
+        return -1;
+
+    return sorted_compact(sorted);
+}
+
+/* sorted_utils.c */
@@ -0,0 +1,632 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : stats_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at reducing arrays & matrices to statistics.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <print_utils.h>
+#include <stats_utils.h>
+#include <cpu_utils.h>
+#include <math.h>
+
+#ifdef UTILS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/* [ Macros ] */
+
+#define STATS_BLOCK (256)   // elements reduced per kernel call, small enough to stay in L1
+
+/* [ Structs ] */
+
+typedef struct
+{
+    double min;
+    double max;
+    double sum;
+    double m2;      // sum of squared deviations from the block mean
+} Stats_Block;
+
+typedef void (*Stats_Kernel)(const void *arr, int len, Stats_Block *blk, bool want_m2);
+
+/* [ Kernels ] */
+
+/*
+ * STATS_SCALAR_KERNEL()
+ * ----------------------
+ * Description:
+ *      Portable block kernel. Four independent accumulators keep the
+ *      dependency chains short and sum the block pairwise.
+ */
+#define STATS_SCALAR_KERNEL(name, T)                                            \
+static void name(const void *arr, int len, Stats_Block *blk, bool want_m2)      \
+{                                                                               \
+    const T *a = arr;                                                           \
+    double lo = (double)a[0];                                                   \
+    double hi = lo;                                                             \
+    double s[4] = { 0.0, 0.0, 0.0, 0.0 };                                       \
+    int i = 0;                                                                  \
+                                                                                \
+    for (; i + 4 <= len; i += 4)                                                \
+    {                                                                           \
+        for (int k = 0; k < 4; ++k)                                             \
+        {                                                                       \
+            double x = (double)a[i + k];                                        \
+            lo = x < lo ? x : lo;                                               \
+            hi = x > hi ? x : hi;                                               \
+            s[k] += x;                                                          \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    for (; i < len; ++i)                                                        \
+    {                                                                           \
+        double x = (double)a[i];                                                \
+        lo = x < lo ? x : lo;                                                   \
+        hi = x > hi ? x : hi;                                                   \
+        s[0] += x;                                                              \
+    }                                                                           \
+                                                                                \
+    blk->min = lo;                                                              \
+    blk->max = hi;                                                              \
+    blk->sum = (s[0] + s[1]) + (s[2] + s[3]);                                   \
+    blk->m2 = 0.0;                                                              \
+                                                                                \
+    if (want_m2)                                                                \
+    {                                                                           \
+        double mean = blk->sum / len;                                           \
+                                                                                \
+        for (i = 0; i < len; ++i)                                               \
+        {                                                                       \
+            double d = (double)a[i] - mean;                                     \
+            blk->m2 += d * d;                                                   \
+        }                                                                       \
+    }                                                                           \
+}
+
+STATS_SCALAR_KERNEL(stats_block_int, int)
+STATS_SCALAR_KERNEL(stats_block_long, long)
+STATS_SCALAR_KERNEL(stats_block_long_long, long long)
+STATS_SCALAR_KERNEL(stats_block_float, float)
+STATS_SCALAR_KERNEL(stats_block_double, double)
+
+#ifdef UTILS_X86_SIMD
+
+/*
+ * STATS_VECTOR_KERNEL()
+ * ----------------------
+ * Description:
+ *      Vectorized block kernel. LOAD widens LANES elements to a vector of
+ *      doubles; two vectors are consumed per iteration.
+ */
+#define STATS_VECTOR_KERNEL(name, isa, T, VEC, LANES, LOAD, SET1, ZERO, MIN, MAX, ADD, SUB, MUL, STORE) \
+__attribute__((target(isa))) static void name(const void *arr, int len, Stats_Block *blk, bool want_m2) \
+{                                                                               \
+    const T *a = arr;                                                           \
+    VEC vmin = SET1((double)a[0]);                                              \
+    VEC vmax = vmin;                                                            \
+    VEC vs0 = ZERO();                                                           \
+    VEC vs1 = ZERO();                                                           \
+    double lane[LANES];                                                         \
+    int i = 0;                                                                  \
+                                                                                \
+    for (; i + 2 * LANES <= len; i += 2 * LANES)                                \
+    {                                                                           \
+        VEC x0 = LOAD(a + i);                                                   \
+        VEC x1 = LOAD(a + i + LANES);                                           \
+        vmin = MIN(vmin, MIN(x0, x1));                                          \
+        vmax = MAX(vmax, MAX(x0, x1));                                          \
+        vs0 = ADD(vs0, x0);                                                     \
+        vs1 = ADD(vs1, x1);                                                     \
+    }                                                                           \
+                                                                                \
+    double lo = (double)a[0];                                                   \
+    double hi = lo;                                                             \
+    double sum = 0.0;                                                           \
+                                                                                \
+    STORE(lane, vmin);                                                          \
+    for (int k = 0; k < LANES; ++k)                                             \
+        lo = lane[k] < lo ? lane[k] : lo;                                       \
+                                                                                \
+    STORE(lane, vmax);                                                          \
+    for (int k = 0; k < LANES; ++k)                                             \
+        hi = lane[k] > hi ? lane[k] : hi;                                       \
+                                                                                \
+    STORE(lane, ADD(vs0, vs1));                                                 \
+    for (int k = 0; k < LANES; ++k)                                             \
+        sum += lane[k];                                                         \
+                                                                                \
+    for (; i < len; ++i)                                                        \
+    {                                                                           \
+        double x = (double)a[i];                                                \
+        lo = x < lo ? x : lo;                                                   \
+        hi = x > hi ? x : hi;                                                   \
+        sum += x;                                                               \
+    }                                                                           \
+                                                                                \
+    blk->min = lo;                                                              \
+    blk->max = hi;                                                              \
+    blk->sum = sum;                                                             \
+    blk->m2 = 0.0;                                                              \
+                                                                                \
+    if (want_m2)                                                                \
+    {                                                                           \
+        double mean = sum / len;                                                \
+        VEC vmean = SET1(mean);                                                 \
+        VEC vm0 = ZERO();                                                       \
+        VEC vm1 = ZERO();                                                       \
+                                                                                \
+        for (i = 0; i + 2 * LANES <= len; i += 2 * LANES)                       \
+        {                                                                       \
+            VEC d0 = SUB(LOAD(a + i), vmean);                                   \
+            VEC d1 = SUB(LOAD(a + i + LANES), vmean);                           \
+            vm0 = ADD(vm0, MUL(d0, d0));                                        \
+            vm1 = ADD(vm1, MUL(d1, d1));                                        \
+        }                                                                       \
+                                                                                \
+        STORE(lane, ADD(vm0, vm1));                                             \
+        for (int k = 0; k < LANES; ++k)                                         \
+            blk->m2 += lane[k];                                                 \
+                                                                                \
+        for (; i < len; ++i)                                                    \
+        {                                                                       \
+            double d = (double)a[i] - mean;                                     \
+            blk->m2 += d * d;                                                   \
+        }                                                                       \
+    }                                                                           \
+}
+
+#define STATS_AVX2_KERNEL(name, T, LOAD) \
+    STATS_VECTOR_KERNEL(name, "avx2", T, __m256d, 4, LOAD, _mm256_set1_pd, _mm256_setzero_pd, \
+        _mm256_min_pd, _mm256_max_pd, _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd, _mm256_storeu_pd)
+
+#define STATS_SSE2_KERNEL(name, T, LOAD) \
+    STATS_VECTOR_KERNEL(name, "sse2", T, __m128d, 2, LOAD, _mm_set1_pd, _mm_setzero_pd, \
+        _mm_min_pd, _mm_max_pd, _mm_add_pd, _mm_sub_pd, _mm_mul_pd, _mm_storeu_pd)
+
+#define AVX2_LOAD_INT(p)    _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)(p)))
+#define AVX2_LOAD_FLOAT(p)  _mm256_cvtps_pd(_mm_loadu_ps(p))
+#define AVX2_LOAD_DOUBLE(p) _mm256_loadu_pd(p)
+
+#define SSE2_LOAD_INT(p)    _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i *)(p)))
+#define SSE2_LOAD_FLOAT(p)  _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)(p))))
+#define SSE2_LOAD_DOUBLE(p) _mm_loadu_pd(p)
+
+STATS_AVX2_KERNEL(stats_block_int_avx2, int, AVX2_LOAD_INT)
+STATS_AVX2_KERNEL(stats_block_float_avx2, float, AVX2_LOAD_FLOAT)
+STATS_AVX2_KERNEL(stats_block_double_avx2, double, AVX2_LOAD_DOUBLE)
+
+STATS_SSE2_KERNEL(stats_block_int_sse2, int, SSE2_LOAD_INT)
+STATS_SSE2_KERNEL(stats_block_float_sse2, float, SSE2_LOAD_FLOAT)
+STATS_SSE2_KERNEL(stats_block_double_sse2, double, SSE2_LOAD_DOUBLE)
+
+#endif // UTILS_X86_SIMD
+
+/*
+ * stats_kernel()
+ * ----------------------
+ * Description:
+ *      Picks the block kernel of the type for the CPU tier.
+ *
+ * Notes:
+ *      - 64-bit integers have no packed conversion to double before
+ *      AVX-512, so they always use the scalar kernel.
+ */
+static Stats_Kernel stats_kernel(Fetch_Type type)
+{
+    static const Stats_Kernel scalar[] = {
+        [TYPE_INT] = stats_block_int,
+        [TYPE_LONG] = stats_block_long,
+        [TYPE_LONG_LONG] = stats_block_long_long,
+        [TYPE_FLOAT] = stats_block_float,
+        [TYPE_DOUBLE] = stats_block_double,
+    };
+
+#ifdef UTILS_X86_SIMD
+    static const Stats_Kernel avx2[] = {
+        [TYPE_INT] = stats_block_int_avx2,
+        [TYPE_LONG] = stats_block_long,
+        [TYPE_LONG_LONG] = stats_block_long_long,
+        [TYPE_FLOAT] = stats_block_float_avx2,
+        [TYPE_DOUBLE] = stats_block_double_avx2,
+    };
+
+    static const Stats_Kernel sse2[] = {
+        [TYPE_INT] = stats_block_int_sse2,
+        [TYPE_LONG] = stats_block_long,
+        [TYPE_LONG_LONG] = stats_block_long_long,
+        [TYPE_FLOAT] = stats_block_float_sse2,
+        [TYPE_DOUBLE] = stats_block_double_sse2,
+    };
+
+    static const Stats_Kernel *const tiers[CPU_TIERS] = {
+        [CPU_TIER_SCALAR] = scalar,
+        [CPU_TIER_SSE2] = sse2,
+        [CPU_TIER_AVX2] = avx2,
+        [CPU_TIER_AVX512] = avx2,
+    };
+
+    return tiers[cpu_tier()][type];
+#else
+    return scalar[type];
+#endif
+}
+
+/*
+ * stats_run()
+ * ----------------------
+ * Description:
+ *      Reduces the array block by block and combines the partial
+ *      results into a summary.
+ */
+static void stats_run(const void *arr, int len, Fetch_Type type, Stats_Summary *summary, bool want_m2)
+{
+    Stats_Kernel kernel = stats_kernel(type);
+    size_t size = type_sizes[type];
+
+    double sum = 0.0, comp = 0.0;
+    double mean = 0.0, m2 = 0.0;
+    double lo = INFINITY, hi = -INFINITY;
+    int n = 0;
+
+    for (int i = 0; i < len; i += STATS_BLOCK)
+    {
+        int cnt = len - i < STATS_BLOCK ? len - i : STATS_BLOCK;
+        Stats_Block blk;
+
+        kernel((const char *)arr + (size_t)i * size, cnt, &blk, want_m2);
+
+        /* Neumaier summation of the block sums. */
+        double t = sum + blk.sum;
+
+        if (fabs(sum) >= fabs(blk.sum))
+            comp += (sum - t) + blk.sum;
+        else
+            comp += (blk.sum - t) + sum;
+
+        sum = t;
+
+        /* Chan's update merges the block variance into the running one. */
+        if (want_m2)
+        {
+            double delta = blk.sum / cnt - mean;
+            double total = (double)n + cnt;
+
+            mean += delta * cnt / total;
+            m2 += blk.m2 + delta * delta * ((double)n * cnt / total);
+        }
+
+        lo = blk.min < lo ? blk.min : lo;
+        hi = blk.max > hi ? blk.max : hi;
+        n += cnt;
+    }
+
+    summary->count = n;
+    summary->min = lo;
+    summary->max = hi;
+    summary->sum = sum + comp;
+    summary->mean = summary->sum / n;
+    summary->variance = want_m2 ? m2 / n : NAN;
+    summary->stddev = want_m2 ? sqrt(summary->variance) : NAN;
+}
+
+/*
+ * stats_pick()
+ * ----------------------
+ * Description:
+ *      Selects the field of a summary that matches the operation.
+ */
+static double stats_pick(const Stats_Summary *summary, Stats_Op op)
+{
+    switch (op)
+    {
+        case STATS_MIN:         return summary->min;
+        case STATS_MAX:         return summary->max;
+        case STATS_SUM:         return summary->sum;
+        case STATS_MEAN:        return summary->mean;
+        case STATS_VARIANCE:    return summary->variance;
+        default:                return NAN;
+    }
+}
+
+/*
+ * stats_valid()
+ * ----------------------
+ * Description:
+ *      Checks the arguments shared by every reduction.
+ */
+static inline bool stats_valid(const void *arr, int len, Fetch_Type type)
+{
+    return arr != NULL && len > 0 && (unsigned)type <= TYPE_DOUBLE;
+}
+
+/*
+ * stats_reduce()
+ * ----------------------
+ * Description:
+ *      Runs a single reduction over an array.
+ */
+static double stats_reduce(const void *arr, int len, Fetch_Type type, Stats_Op op)
+{
+    Stats_Summary summary;
+
+    if (!stats_valid(arr, len, type))
+        return op == STATS_SUM ? 0.0 : NAN;
+
+    stats_run(arr, len, type, &summary, op == STATS_VARIANCE);
+    return stats_pick(&summary, op);
+}
+
+/* [ Functions ] */
+
+/*
+ * stats_describe()
+ * ----------------------
+ * Description:
+ *      Computes every statistic of an array in a single pass.
+ */
+int stats_describe(const void *arr, int len, Fetch_Type type, Stats_Summary *summary)
+{
+    if (!stats_valid(arr, len, type) || summary == NULL)
+        return -1;
+
+    stats_run(arr, len, type, summary, true);
+    return 0;
+}
+
+/*
+ * stats_min()
+ * ----------------------
+ * Description:
+ *      Returns the smallest value of an array.
+ */
+double stats_min(const void *arr, int len, Fetch_Type type)
+{
+    return stats_reduce(arr, len, type, STATS_MIN);
+}
+
+/*
+ * stats_max()
+ * ----------------------
+ * Description:
+ *      Returns the largest value of an array.
+ */
+double stats_max(const void *arr, int len, Fetch_Type type)
+{
+    return stats_reduce(arr, len, type, STATS_MAX);
+}
+
+/*
+ * stats_sum()
+ * ----------------------
+ * Description:
+ *      Returns the compensated sum of an array.
+ */
+double stats_sum(const void *arr, int len, Fetch_Type type)
+{
+    return stats_reduce(arr, len, type, STATS_SUM);
+}
+
+/*
+ * stats_mean()
+ * ----------------------
+ * Description:
+ *      Returns the arithmetic mean of an array.
+ */
+double stats_mean(const void *arr, int len, Fetch_Type type)
+{
+    return stats_reduce(arr, len, type, STATS_MEAN);
+}
+
+/*
+ * stats_variance()
+ * ----------------------
+ * Description:
+ *      Returns the population variance of an array.
+ */
+double stats_variance(const void *arr, int len, Fetch_Type type)
+{
+    return stats_reduce(arr, len, type, STATS_VARIANCE);
+}
+
+/*
+ * STATS_HISTOGRAM()
+ * ----------------------
+ * Description:
+ *      Generates a histogram loop for one element type.
+ */
+#define STATS_HISTOGRAM(name, T)                                                \
+static int name(const void *arr, int len, double min, double max, int *bins, int bin_cnt) \
+{                                                                               \
+    const T *a = arr;                                                           \
+    /* Halving both ends keeps a span like -DBL_MAX..DBL_MAX finite. */         \
+    double half = isfinite(max - min) ? 1.0 : 0.5;                              \
+    double scale = bin_cnt / (max * half - min * half);                         \
+    int counted = 0;                                                            \
+                                                                                \
+    for (int i = 0; i < len; ++i)                                               \
+    {                                                                           \
+        double x = (double)a[i];                                                \
+                                                                                \
+        /* Written so that NaN fails too. */                                    \
+        if (!(x >= min && x <= max))                                            \
+            continue;                                                           \
+                                                                                \
+        /* NaN (0 * inf over a denormal span) and inf clamp to the ends. */     \
+        double pos = (x * half - min * half) * scale;                           \
+        int bin = pos > 0 ? (pos < bin_cnt ? (int)pos : bin_cnt - 1) : 0;       \
+        bins[bin]++;                                                            \
+        counted++;                                                              \
+    }                                                                           \
+                                                                                \
+    return counted;                                                             \
+}
+
+STATS_HISTOGRAM(stats_histogram_int, int)
+STATS_HISTOGRAM(stats_histogram_long, long)
+STATS_HISTOGRAM(stats_histogram_long_long, long long)
+STATS_HISTOGRAM(stats_histogram_float, float)
+STATS_HISTOGRAM(stats_histogram_double, double)
+
+/*
+ * stats_histogram()
+ * ----------------------
+ * Description:
+ *      Counts the values of an array into equal-width bins.
+ */
+int stats_histogram(const void *arr, int len, Fetch_Type type, double min, double max, int *bins, int bin_cnt)
+{
+    if (!stats_valid(arr, len, type) || bins == NULL || bin_cnt <= 0 || !(max > min) || !isfinite(min) || !isfinite(max))
+    {
+        print_log("[ERROR]", RED, "Invalid histogram arguments\n");
+        return -1;
+    }
+
+    memset(bins, 0, (size_t)bin_cnt * sizeof(int));
+
+    switch (type)
+    {
+        case TYPE_INT:          return stats_histogram_int(arr, len, min, max, bins, bin_cnt);
+        case TYPE_LONG:         return stats_histogram_long(arr, len, min, max, bins, bin_cnt);
+        case TYPE_LONG_LONG:    return stats_histogram_long_long(arr, len, min, max, bins, bin_cnt);
+        case TYPE_FLOAT:        return stats_histogram_float(arr, len, min, max, bins, bin_cnt);
+        case TYPE_DOUBLE:       return stats_histogram_double(arr, len, min, max, bins, bin_cnt);
+        default:                return -1;
+    }
+}
+
+/*
+ * stats_reduce_rows()
+ * ----------------------
+ * Description:
+ *      Applies a reduction to every row of a matrix.
+ */
+int stats_reduce_rows(void **matrix, int rows, int cols, Fetch_Type type, Stats_Op op, double *out)
+{
+    if (matrix == NULL || out == NULL || rows <= 0 || !stats_valid(matrix[0], cols, type))
+        return -1;
+
+    for (int i = 0; i < rows; ++i)
+        out[i] = stats_reduce(matrix[i], cols, type, op);
+
+    return 0;
+}
+
+/*
+ * STATS_WIDEN()
+ * ----------------------
+ * Description:
+ *      Generates a loop that widens one row to doubles.
+ */
+#define STATS_WIDEN(name, T)                                                    \
+static void name(const void *row, int cols, double *dst)                        \
+{                                                                               \
+    const T *a = row;                                                           \
+                                                                                \
+    for (int j = 0; j < cols; ++j)                                              \
+        dst[j] = (double)a[j];                                                  \
+}
+
+STATS_WIDEN(stats_widen_int, int)
+STATS_WIDEN(stats_widen_long, long)
+STATS_WIDEN(stats_widen_long_long, long long)
+STATS_WIDEN(stats_widen_float, float)
+STATS_WIDEN(stats_widen_double, double)
+
+/*
+ * stats_reduce_cols()
+ * ----------------------
+ * Description:
+ *      Applies a reduction to every column of a matrix,
+ *      streaming the rows into per-column accumulators.
+ */
+int stats_reduce_cols(void **matrix, int rows, int cols, Fetch_Type type, Stats_Op op, double *out)
+{
+    static void (*const widen[])(const void *, int, double *) = {
+        [TYPE_INT] = stats_widen_int,
+        [TYPE_LONG] = stats_widen_long,
+        [TYPE_LONG_LONG] = stats_widen_long_long,
+        [TYPE_FLOAT] = stats_widen_float,
+        [TYPE_DOUBLE] = stats_widen_double,
+    };
+
+    if (matrix == NULL || out == NULL || rows <= 0 || !stats_valid(matrix[0], cols, type) || (unsigned)op > STATS_VARIANCE)
+        return -1;
+
+    /* One widened row plus one auxiliary accumulator per column. */
+    double *row = malloc(2 * (size_t)cols * sizeof(double));
+    if (row == NULL)
+    {
+        print_log("[ERROR]", RED, "Memory allocation failed for column accumulators\n");
+        return -1;
+    }
+
+    double *aux = row + cols;
+
+    widen[type](matrix[0], cols, out);
+    memset(aux, 0, (size_t)cols * sizeof(double));
+
+    for (int i = 1; i < rows; ++i)
+    {
+        widen[type](matrix[i], cols, row);
+
+        switch (op)
+        {
+            case STATS_MIN:
+                for (int j = 0; j < cols; ++j)
+                    out[j] = row[j] < out[j] ? row[j] : out[j];
+                break;
+
+            case STATS_MAX:
+                for (int j = 0; j < cols; ++j)
+                    out[j] = row[j] > out[j] ? row[j] : out[j];
+                break;
+
+            case STATS_SUM:
+            case STATS_MEAN:
+                /* Kahan summation, the compensation lives in aux[]. */
+                for (int j = 0; j < cols; ++j)
+                {
+                    double y = row[j] - aux[j];
+                    double t = out[j] + y;
+
+                    aux[j] = (t - out[j]) - y;
+                    out[j] = t;
+                }
+                break;
+
+            case STATS_VARIANCE:
+                /* Welford's update, the mean lives in out[] and M2 in aux[]. */
+                for (int j = 0; j < cols; ++j)
+                {
+                    double delta = row[j] - out[j];
+
+                    out[j] += delta / (i + 1);
+                    aux[j] += delta * (row[j] - out[j]);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (op == STATS_MEAN || op == STATS_VARIANCE)
+    {
+        for (int j = 0; j < cols; ++j)
+            out[j] = op == STATS_MEAN ? out[j] / rows : aux[j] / rows;
+    }
+
+    free(row);
+    return 0;
+}
+
+/* stats_utils.c */
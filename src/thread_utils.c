@@ -0,0 +1,47 @@
+/*
+ * [ libcustomutils ]
+ * ----------------------
+ * File Name    : thread_utils.c
+ * Author       : Heisnx (c)
+ * Date Created : 19/10/2026
+ * Last Modified: 19/10/2026
+ *
+ * Description:
+ *      This source file contains functions oriented
+ *      at splitting work between threads.
+ */
+
+/* [ Headers ] */
+#include <custom_utils.h>
+#include <thread_utils.h>
+
+/* [ Functions ] */
+
+/*
+ * thread_fork_join()
+ * ----------------------
+ * Description:
+ *      Runs fn on every item, items 1 and up on their own threads.
+ */
+void thread_fork_join(void *(*fn)(void *), void *items, size_t stride, int count, pthread_t *tid)
+{
+    char *item = items;
+    int spawned = 1;
+
+    if (count <= 0)
+        return;
+
+    /* Every other item starts first, so item 0 never holds them back. */
+    while (spawned < count && pthread_create(&tid[spawned], NULL, fn, item + (size_t)spawned * stride) == 0)
+        spawned++;
+
+    fn(item);
+
+    for (int p = spawned; p < count; ++p)
+        fn(item + (size_t)p * stride);
+
+    for (int p = 1; p < spawned; ++p)
+        pthread_join(tid[p], NULL);
+}
+
+/* thread_utils.c */